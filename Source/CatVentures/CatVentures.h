@@ -4,3 +4,5 @@
 
 #include "CoreMinimal.h"
 
+/** `stat CatVentures` — gameplay-side counters and cycle stats for the project's systems. */
+DECLARE_STATS_GROUP(TEXT("CatVentures"), STATGROUP_CatVentures, STATCAT_Advanced);
@@ -0,0 +1,314 @@
+// CatAsyncPhysicsSubsystem.cpp
+
+#include "CatAsyncPhysicsSubsystem.h"
+#include "CatBase.h"
+#include "CatVentures.h"
+#include "Chaos/SimCallbackInput.h"
+#include "Chaos/SimCallbackObject.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Physics/Experimental/PhysScene_Chaos.h"
+#include "PhysicsEngine/BodyInstance.h"
+#include "PhysicsEngine/PhysicsSettings.h"
+#include "PhysicsProxy/SingleParticlePhysicsProxy.h"
+#include "PhysicsSolver.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Async Impulses Queued"), STAT_CatAsyncImpulses, STATGROUP_CatVentures);
+DECLARE_CYCLE_STAT(TEXT("Async Physics Callback"), STAT_CatAsyncCallback, STATGROUP_CatVentures);
+
+// ── Console ─────────────────────────────────────────────────────────────
+
+static TAutoConsoleVariable<bool> CVarCatAsyncPhysicsCallbacks(
+	TEXT("cat.Physics.AsyncCallbacks"),
+	true,
+	TEXT("Run bumper pushes and the grab reach check in a fixed-step physics-thread callback. ")
+	TEXT("Only takes effect with the async physics tick, which the project leaves off; off = the game-thread paths."));
+
+// ── Physics-thread callback ─────────────────────────────────────────────
+
+struct FCatAsyncPhysicsInput : public Chaos::FSimCallbackInput
+{
+	uint32 Serial = 0;
+	TArray<TPair<FCatAsyncParticleRef, FVector>> Impulses;
+	TArray<TPair<uint32, FCatAsyncCatInput>> Cats;
+	TArray<uint32> Removed;
+
+	void Reset()
+	{
+		Serial = 0;
+		Impulses.Reset();
+		Cats.Reset();
+		Removed.Reset();
+	}
+};
+
+struct FCatAsyncPhysicsOutput : public Chaos::FSimCallbackOutput
+{
+	TArray<TPair<uint32, FCatAsyncCatOutput>> Cats;
+
+	void Reset()
+	{
+		Cats.Reset();
+	}
+};
+
+class FCatAsyncPhysicsCallback : public Chaos::TSimCallbackObject<FCatAsyncPhysicsInput, FCatAsyncPhysicsOutput>
+{
+public:
+	virtual FName GetFNameForStatId() const override
+	{
+		const static FLazyName StaticName("FCatAsyncPhysicsCallback");
+		return StaticName;
+	}
+
+	virtual void OnPreSimulate_Internal() override;
+
+private:
+	/** Physics thread only. */
+	TMap<uint32, FCatAsyncCatInput> Cats;
+	uint32 LastSerial = 0;
+
+	static Chaos::FRigidBodyHandle_Internal* Resolve(const FCatAsyncParticleRef& Ref);
+	static void ApplyImpulse(const FCatAsyncParticleRef& Ref, const FVector& Impulse);
+};
+
+Chaos::FRigidBodyHandle_Internal* FCatAsyncPhysicsCallback::Resolve(const FCatAsyncParticleRef& Ref)
+{
+	// A body destroyed after handover has its particle unregistered by the same push that
+	// carries this input, and Chaos clears the proxy's handle before any callback runs. The
+	// proxy itself is freed only after that step, by which time a newer input replaces Ref.
+	if (!Ref.Proxy || !Ref.Proxy->GetHandle_LowLevel()) return nullptr;
+	return Ref.Proxy->GetPhysicsThreadAPI();
+}
+
+void FCatAsyncPhysicsCallback::ApplyImpulse(const FCatAsyncParticleRef& Ref, const FVector& Impulse)
+{
+	Chaos::FRigidBodyHandle_Internal* Rigid = Resolve(Ref);
+	if (!Rigid) return;
+
+	if (Rigid->ObjectState() == Chaos::EObjectStateType::Sleeping)
+	{
+		Rigid->SetObjectState(Chaos::EObjectStateType::Dynamic, /*bAllowEvents=*/true);
+	}
+	if (Rigid->ObjectState() != Chaos::EObjectStateType::Dynamic) return;
+
+	// Same result as AddImpulse(bVelChange=false): Δv = J / m.
+	Rigid->SetV(Rigid->V() + Chaos::FVec3(Impulse) * Rigid->InvM());
+}
+
+void FCatAsyncPhysicsCallback::OnPreSimulate_Internal()
+{
+	SCOPE_CYCLE_COUNTER(STAT_CatAsyncCallback);
+
+	// A frame's input can span several fixed steps — only its first step consumes it.
+	const FCatAsyncPhysicsInput* Input = GetConsumerInput();
+	if (Input && Input->Serial != LastSerial)
+	{
+		LastSerial = Input->Serial;
+
+		for (const uint32 Key : Input->Removed)
+		{
+			Cats.Remove(Key);
+		}
+
+		// Each frame's input replaces a cat's previous one. A cat that sent nothing this
+		// frame has no grab to check.
+		for (TPair<uint32, FCatAsyncCatInput>& Pair : Cats)
+		{
+			Pair.Value.Held = FCatAsyncParticleRef();
+		}
+		for (const TPair<uint32, FCatAsyncCatInput>& Pair : Input->Cats)
+		{
+			Cats.FindOrAdd(Pair.Key) = Pair.Value;
+		}
+
+		for (const TPair<FCatAsyncParticleRef, FVector>& Pair : Input->Impulses)
+		{
+			ApplyImpulse(Pair.Key, Pair.Value);
+		}
+	}
+
+	FCatAsyncPhysicsOutput& Output = GetProducerOutputData_Internal();
+
+	for (const TPair<uint32, FCatAsyncCatInput>& Pair : Cats)
+	{
+		const FCatAsyncCatInput& CatInput = Pair.Value;
+
+		FCatAsyncCatOutput Result;
+		Result.GrabSequence = CatInput.GrabSequence;
+
+		// ── Grab reach — mirrors ACatBase::UpdateGrab's game-thread check ──
+		if (const Chaos::FRigidBodyHandle_Internal* Held = Resolve(CatInput.Held))
+		{
+			const FVector HeldLocation(Held->X());
+			Result.bGrabOverreached =
+				FVector::DistSquared(HeldLocation, CatInput.GrabTarget) > FMath::Square(CatInput.MaxGrabDistance);
+		}
+
+		Output.Cats.Emplace(Pair.Key, Result);
+	}
+}
+
+// ── Subsystem ───────────────────────────────────────────────────────────
+
+UCatAsyncPhysicsSubsystem* UCatAsyncPhysicsSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UCatAsyncPhysicsSubsystem>() : nullptr;
+}
+
+UCatAsyncPhysicsSubsystem* UCatAsyncPhysicsSubsystem::GetActive(const UObject* WorldContextObject)
+{
+	UCatAsyncPhysicsSubsystem* Subsystem = Get(WorldContextObject);
+	return Subsystem && Subsystem->IsActive() ? Subsystem : nullptr;
+}
+
+bool UCatAsyncPhysicsSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UCatAsyncPhysicsSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCatAsyncPhysicsSubsystem, STATGROUP_Tickables);
+}
+
+bool UCatAsyncPhysicsSubsystem::IsActive() const
+{
+	return Callback && CVarCatAsyncPhysicsCallbacks.GetValueOnGameThread();
+}
+
+void UCatAsyncPhysicsSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// A synchronous physics tick already runs at the frame rate — nothing to gain.
+	if (!UPhysicsSettings::Get()->bTickPhysicsAsync)
+	{
+		UE_LOG(LogTemp, Log, TEXT("CatAsyncPhysics: async physics tick is off — cat physics stays on the game thread"));
+		return;
+	}
+
+	FPhysScene* Scene = InWorld.GetPhysicsScene();
+	Chaos::FPhysicsSolver* Solver = Scene ? Scene->GetSolver() : nullptr;
+	if (!Solver) return;
+
+	Callback = Solver->CreateAndRegisterSimCallbackObject_External<FCatAsyncPhysicsCallback>();
+}
+
+void UCatAsyncPhysicsSubsystem::Deinitialize()
+{
+	if (Callback)
+	{
+		const UWorld* World = GetWorld();
+		FPhysScene* Scene = World ? World->GetPhysicsScene() : nullptr;
+		if (Chaos::FPhysicsSolver* Solver = Scene ? Scene->GetSolver() : nullptr)
+		{
+			Solver->UnregisterAndFreeSimCallbackObject_External(Callback);
+		}
+		Callback = nullptr;
+	}
+
+	PendingImpulses.Reset();
+	PendingCats.Reset();
+	PendingRemovals.Reset();
+	LatestOutputs.Reset();
+
+	Super::Deinitialize();
+}
+
+Chaos::FSingleParticlePhysicsProxy* UCatAsyncPhysicsSubsystem::GetSingleParticleProxy(const UPrimitiveComponent* Body)
+{
+	const FBodyInstance* BodyInstance = Body ? Body->GetBodyInstance() : nullptr;
+	Chaos::FSingleParticlePhysicsProxy* Proxy = BodyInstance ? BodyInstance->GetPhysicsActorHandle() : nullptr;
+	return Proxy && !Proxy->GetMarkedDeleted() ? Proxy : nullptr;
+}
+
+uint32 UCatAsyncPhysicsSubsystem::GetCatKey(const ACatBase* Cat)
+{
+	return Cat->GetUniqueID();
+}
+
+bool UCatAsyncPhysicsSubsystem::QueueImpulse(const UPrimitiveComponent* Body, const FVector& Impulse)
+{
+	if (!GetSingleParticleProxy(Body)) return false;
+
+	// The proxy is looked up again at handover — Body may lose it before Tick.
+	PendingImpulses.Add({ Body, Impulse });
+	INC_DWORD_STAT(STAT_CatAsyncImpulses);
+	return true;
+}
+
+FCatAsyncCatInput& UCatAsyncPhysicsSubsystem::EditCatInput(const ACatBase* Cat)
+{
+	return PendingCats.FindOrAdd(GetCatKey(Cat));
+}
+
+const FCatAsyncCatOutput* UCatAsyncPhysicsSubsystem::FindCatOutput(const ACatBase* Cat) const
+{
+	return LatestOutputs.Find(GetCatKey(Cat));
+}
+
+void UCatAsyncPhysicsSubsystem::RemoveCat(const ACatBase* Cat)
+{
+	const uint32 Key = GetCatKey(Cat);
+	PendingCats.Remove(Key);
+	LatestOutputs.Remove(Key);
+
+	// Without a callback Tick never hands removals over — don't let them pile up.
+	if (Callback)
+	{
+		PendingRemovals.Add(Key);
+	}
+}
+
+void UCatAsyncPhysicsSubsystem::Tick(float DeltaTime)
+{
+	if (!Callback) return;
+
+	// ── Hand over: everything the cats wrote this frame, as one input ──
+	if (FCatAsyncPhysicsInput* Input = Callback->GetProducerInputData_External())
+	{
+		// Zero is the callback's "nothing consumed yet" value.
+		InputSerial = InputSerial == MAX_uint32 ? 1 : InputSerial + 1;
+		Input->Serial = InputSerial;
+
+		// The same input can be handed over on several frames before a step consumes it, so
+		// merge into it rather than replace. A later entry for a cat wins over an earlier
+		// one; a removal also drops that cat's earlier entries.
+		Input->Impulses.Reserve(Input->Impulses.Num() + PendingImpulses.Num());
+		for (const FQueuedImpulse& Queued : PendingImpulses)
+		{
+			if (Chaos::FSingleParticlePhysicsProxy* Proxy = GetSingleParticleProxy(Queued.Body.Get()))
+			{
+				Input->Impulses.Emplace(FCatAsyncParticleRef{ Proxy }, Queued.Impulse);
+			}
+		}
+		if (!PendingRemovals.IsEmpty())
+		{
+			Input->Cats.RemoveAll([this](const TPair<uint32, FCatAsyncCatInput>& Pair)
+			{
+				return PendingRemovals.Contains(Pair.Key);
+			});
+		}
+		for (TPair<uint32, FCatAsyncCatInput>& Pair : PendingCats)
+		{
+			Pair.Value.Held.Proxy = GetSingleParticleProxy(Pair.Value.HeldBody.Get());
+			Input->Cats.Add(Pair);
+		}
+		Input->Removed.Append(PendingRemovals);
+	}
+	PendingImpulses.Reset();
+	PendingCats.Reset();
+	PendingRemovals.Reset();
+
+	// ── Collect: newest result per cat wins ──
+	while (Chaos::TSimCallbackOutputHandle<FCatAsyncPhysicsOutput> Output = Callback->PopFutureOutputData_External())
+	{
+		for (const TPair<uint32, FCatAsyncCatOutput>& Pair : Output->Cats)
+		{
+			LatestOutputs.Add(Pair.Key, Pair.Value);
+		}
+	}
+}
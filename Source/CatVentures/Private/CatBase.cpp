@@ -1,7 +1,15 @@
 // CatBase.cpp
 
 #include "CatBase.h"
+#include "CatVentures.h"
 #include "CatAnimationTypes.h"
+#include "CatLatencySubsystem.h"
+#include "CatFootIKComponent.h"
+#include "CatGameState.h"
+#include "CatDebrisSubsystem.h"
+#include "CatAsyncPhysicsSubsystem.h"
+#include "CatDestructibleSubsystem.h"
+#include "CatPhysicsPropSubsystem.h"
 #include "Net/UnrealNetwork.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/SpringArmComponent.h"
@@ -14,12 +22,31 @@
 #include "InteractableInterface.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "GeometryCollection/GeometryCollectionComponent.h"
+#include "GeometryCollection/GeometryCollectionObject.h"
+#include "GeometryCollection/Facades/CollectionDynamicStateFacade.h"
 #include "Components/BoxComponent.h"
 #include "Components/CapsuleComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "PhysicsEngine/BodyInstance.h"
 #include "PhysicsEngine/PhysicsConstraintComponent.h"
-#include "DrawDebugHelpers.h"
 #include "Kismet/GameplayStatics.h"
 
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Bumper Overlaps Processed"), STAT_CatBumperProcessed, STATGROUP_CatVentures);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Bumper Overlaps Filtered"),  STAT_CatBumperFiltered,  STATGROUP_CatVentures);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Bumper Impulses Merged"),    STAT_CatBumperMerged,    STATGROUP_CatVentures);
+DECLARE_CYCLE_STAT(TEXT("Grab Bind"),   STAT_CatGrabBind,   STATGROUP_CatVentures);
+DECLARE_CYCLE_STAT(TEXT("Grab Unbind"), STAT_CatGrabUnbind, STATGROUP_CatVentures);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Held Body Samples Rejected"), STAT_CatHeldBodyRejected, STATGROUP_CatVentures);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Predicted Prop Impulses"),    STAT_CatPredictedImpulses, STATGROUP_CatVentures);
+
+// ── Console ─────────────────────────────────────────────────────────────
+
+static TAutoConsoleVariable<bool> CVarCatGrabOwnerSimulation(
+	TEXT("cat.Grab.OwnerSimulation"),
+	true,
+	TEXT("Hand a held rigid body's simulation to the holder's owning client. ")
+	TEXT("Off = every machine simulates it under its own constraint. Applies from the next grab."));
+
 ACatBase::ACatBase()
 {
 	PrimaryActorTick.bCanEverTick = true;
@@ -42,11 +69,16 @@ ACatBase::ACatBase()
 	PhysicsBumper->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
 	PhysicsBumper->SetCollisionResponseToAllChannels(ECR_Ignore);
 	PhysicsBumper->SetCollisionResponseToChannel(ECC_PhysicsBody, ECR_Overlap);
-	PhysicsBumper->SetCollisionResponseToChannel(ECC_Destructible, ECR_Overlap);
 	PhysicsBumper->SetGenerateOverlapEvents(true);
 
+	// ── Foot IK ───────────────────────────────────────────────────
+	// Traces are batched across all cats by UCatFootIKSubsystem — the component has no tick.
+	FootIK = CreateDefaultSubobject<UCatFootIKComponent>(TEXT("FootIK"));
+
 	// ── Mouth Grab ────────────────────────────────────────────────
-	// GrabConstraint is created dynamically in Server_Grab_Implementation — not a CDO subobject.
+	// One constraint per cat for its whole life — grabs only rebind it, so no UObject is
+	// created or garbage-collected per grab. The solver joint is still built on each bind.
+	GrabConstraint = CreateDefaultSubobject<UPhysicsConstraintComponent>(TEXT("GrabConstraint"));
 
 	GrabTargetLocation = CreateDefaultSubobject<USceneComponent>(TEXT("GrabTargetLocation"));
 	GrabTargetLocation->SetupAttachment(GetMesh(), TEXT("socket_mouth"));
@@ -54,6 +86,8 @@ ACatBase::ACatBase()
 	// in front of the cat's capsule rather than pressing against it.
 	GrabTargetLocation->SetRelativeLocation(FVector(80.0f, 0.0f, 0.0f));
 
+	GrabConstraint->SetupAttachment(GrabTargetLocation);
+
 	// ── Rotation settings ────────────────────────────────────────
 	bUseControllerRotationPitch = false;
 	bUseControllerRotationYaw   = false;
@@ -121,6 +155,27 @@ void ACatBase::BeginPlay()
 	}
 	GravityScaleInterp = GravityScaleRising;
 	JumpMaxHoldTime = JumpMaxHoldTimeTuning;
+
+	ConfigureGrabConstraint();
+
+	// Cache the mesh's animated setup so a knockout can stand the cat back up.
+	MeshRelativeTransformCache = GetMesh()->GetRelativeTransform();
+	MeshCollisionProfileCache  = GetMesh()->GetCollisionProfileName();
+}
+
+void ACatBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// A held body would otherwise keep its gravity off and its replicated movement ignored.
+	if (bIsGrabbing)
+	{
+		ReleaseGrabLocal();
+	}
+	if (UCatAsyncPhysicsSubsystem* AsyncPhysics = UCatAsyncPhysicsSubsystem::Get(this))
+	{
+		AsyncPhysics->RemoveCat(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void ACatBase::OnBumperOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
@@ -129,6 +184,73 @@ void ACatBase::OnBumperOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor*
 {
 	if (!OtherActor || !OtherComp) return;
 
+	// GCs that also block PhysicsBody — QueryBumperDestructibles already reports them.
+	if (OtherComp->IsA<UGeometryCollectionComponent>()) return;
+
+	HandleBumperContact(OtherActor, OtherComp);
+}
+
+void ACatBase::QueryBumperDestructibles()
+{
+	const UCatDestructibleSubsystem* Registry = UCatDestructibleSubsystem::Get(this);
+	if (!Registry) return;
+
+	// The bumper box against each nearby GC's live bounds box. Coarser than an overlap with
+	// the GC's particles, but a hash lookup instead of a scene query against every piece.
+	const FBox BumperBox = PhysicsBumper->Bounds.GetBox();
+	TArray<uint32> Nearby;
+	Registry->QueryRadius(BumperBox.GetCenter(), BumperBox.GetExtent().Size(), Nearby);
+
+	TSet<uint32> Touching;
+	for (const uint32 Id : Nearby)
+	{
+		const FCatDestructibleEntry* Entry = Registry->Find(Id);
+		UGeometryCollectionComponent* GCC = Entry ? Entry->GCC.Get() : nullptr;
+		if (!GCC || !GCC->Bounds.GetBox().Intersect(BumperBox)) continue;
+
+		Touching.Add(Id);
+		if (!BumperTouchingDestructibles.Contains(Id))
+		{
+			HandleBumperContact(Entry->Actor.Get(), GCC);
+		}
+	}
+
+	BumperTouchingDestructibles = MoveTemp(Touching);
+}
+
+void ACatBase::HandleBumperContact(AActor* OtherActor, UPrimitiveComponent* OtherComp)
+{
+	if (!OtherActor || !OtherComp) return;
+
+	// Stage 0 — storm filters. A body already queued this frame merges into its pending
+	// impulse: checked before the cooldown, which the first contact has just stamped.
+	if (PendingBumperImpulses.Contains(OtherComp))
+	{
+		INC_DWORD_STAT(STAT_CatBumperMerged);
+		return;
+	}
+
+	// A shattering GC or a tumbling stack re-enters the bumper many times a second; drop
+	// repeats before any of the checks below run.
+	const double Now = GetWorld()->GetTimeSeconds();
+	if (const double* LastContact = BumperContactTimes.Find(OtherComp))
+	{
+		if (Now - *LastContact < BumperContactCooldown)
+		{
+			INC_DWORD_STAT(STAT_CatBumperFiltered);
+			return;
+		}
+	}
+
+	const bool bIsGC = OtherComp->IsA<UGeometryCollectionComponent>();
+	const UCatDestructibleSubsystem* Registry = bIsGC ? UCatDestructibleSubsystem::Get(this) : nullptr;
+	const uint32 DestructibleId = Registry ? Registry->GetId(OtherActor) : UCatDestructibleSubsystem::InvalidId;
+	if (DestructibleId != UCatDestructibleSubsystem::InvalidId && Registry->IsShattered(DestructibleId))
+	{
+		INC_DWORD_STAT(STAT_CatBumperFiltered);
+		return;
+	}
+
 	// Stage 1 — CMC floor check (primary, rotation-agnostic).
 	// If the cat is grounded on this exact component, suppress the interaction.
 	if (GetCharacterMovement()->CurrentFloor.HitResult.GetComponent() == OtherComp) return;
@@ -140,61 +262,127 @@ void ACatBase::OnBumperOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor*
 	const float ObjTopZ = OtherComp->Bounds.GetBox().Max.Z;
 	if (ObjTopZ <= FeetZ + UnderFootTolerance) return;
 
+	BumperContactTimes.Add(OtherComp, Now);
+	INC_DWORD_STAT(STAT_CatBumperProcessed);
+
 	// Use the bumper's actual world position as the damage/impulse origin,
 	// not the actor root — the root sits 60 cm behind the bumper face.
 	const FVector BumperOrigin = PhysicsBumper->GetComponentLocation();
 
-	// Path A — rigid body push impulse. Server-authoritative; physics replicates normally.
-	if (HasAuthority() && OtherComp->IsSimulatingPhysics())
+	// Path A — rigid body push impulse. Server-authoritative; the owning client also pushes
+	// its own copy of predicted props so the contact responds without a round trip, and
+	// PredictiveInterpolation blends the server's result in instead of snapping.
+	// Queued, not applied: every contact with the same body this frame merges into one
+	// impulse, flushed by FlushBumperImpulses at the start of the next tick.
+	const bool bPredictPush = !HasAuthority() && IsLocallyControlled()
+		&& UCatPhysicsPropSubsystem::IsPredictedProp(OtherComp);
+	if ((HasAuthority() || bPredictPush) && OtherComp->IsSimulatingPhysics())
 	{
-		FVector Vel = GetVelocity();
-		Vel.Z = 0.0f;
-		const FVector ImpulseDir = Vel.SizeSquared() > 1.0f ? Vel.GetSafeNormal() : GetActorForwardVector();
-		OtherComp->AddImpulse(ImpulseDir * BumperPushForce, NAME_None, /*bVelChange=*/false);
+		if (bPredictPush)
+		{
+			INC_DWORD_STAT(STAT_CatPredictedImpulses);
+		}
+
+		PendingBumperImpulses.Add(OtherComp);
 	}
 
-	// Path B — GC fracture via RPC pattern.
+	// Path B — GC fracture via the GameState fracture log.
 	//
 	// ApplyExternalStrain modifies the local Chaos physics solver — every peer must call
 	// it independently for deterministic simultaneous fracture. Only the cat's owning
 	// machine reports the hit (IsLocallyControlled gate), preventing the server copy of a
-	// remote pawn from racing the client's Server RPC and double-triggering the multicast.
-	if (Cast<UGeometryCollectionComponent>(OtherComp))
+	// remote pawn from racing the client's Server RPC and double-logging the fracture.
+	if (bIsGC)
 	{
 		if (!IsLocallyControlled()) return;
 
+		// Unregistered GCs (runtime-spawned) have no net ID and can't be fractured over the wire.
+		if (DestructibleId == UCatDestructibleSubsystem::InvalidId) return;
+
 		if (HasAuthority())
 		{
-			// Listen server host's own cat — authority, call multicast directly.
-			Multicast_BumperHitGC(OtherActor, BumperOrigin, BumperDamageRadius, BumperChaosImpulse);
+			// Listen server host's own cat — authority, log directly.
+			if (ACatGameState* GS = GetWorld()->GetGameState<ACatGameState>())
+			{
+				GS->QueueFractureEvent(DestructibleId, BumperOrigin, BumperFractureTuning, GetBumperStrain());
+			}
 		}
 		else
 		{
-			// Client's own cat — send to server for validation, server then multicasts.
-			Server_BumperHitGC(OtherActor, BumperOrigin);
+			// Client's own cat — send to server for validation, server then logs.
+			Server_BumperHitGC(DestructibleId, BumperOrigin);
 		}
 	}
 }
 
-void ACatBase::Server_BumperHitGC_Implementation(AActor* GCActor, FVector Origin)
+void ACatBase::Server_BumperHitGC_Implementation(uint32 DestructibleId, FVector_NetQuantize10 Origin)
 {
-	if (!GCActor) return;
+	const UCatDestructibleSubsystem* Registry = UCatDestructibleSubsystem::Get(this);
+	if (!Registry) return;
 
-	// Range check using the server's authoritative pawn position.
-	// 300 cm = bumper reach (60) + damage radius (200) + prediction jitter buffer (40).
-	constexpr float MaxReachCm = 300.0f;
-	if (FVector::Dist(GetActorLocation(), GCActor->GetActorLocation()) > MaxReachCm) return;
+	// Range check using the server's authoritative pawn position against the prop's bounds.
+	// 100 cm = bumper reach (60) + prediction jitter buffer (40).
+	constexpr float MaxReachCm = 100.0f;
+	if (!Registry->IsInReach(DestructibleId, GetActorLocation(), MaxReachCm)) return;
 
-	Multicast_BumperHitGC(GCActor, Origin, BumperDamageRadius, BumperChaosImpulse);
+	if (ACatGameState* GS = GetWorld()->GetGameState<ACatGameState>())
+	{
+		GS->QueueFractureEvent(DestructibleId, Origin, BumperFractureTuning, GetBumperStrain());
+	}
 }
 
-void ACatBase::Multicast_BumperHitGC_Implementation(AActor* GCActor, FVector Origin, float Radius, float Strain)
+void ACatBase::FlushBumperImpulses()
 {
-	if (!GCActor) return;
-	UGeometryCollectionComponent* GCC = GCActor->FindComponentByClass<UGeometryCollectionComponent>();
-	if (!GCC) return;
+	if (!PendingBumperImpulses.IsEmpty())
+	{
+		FVector Vel = GetVelocity();
+		Vel.Z = 0.0f;
+		const FVector ImpulseDir = Vel.SizeSquared() > 1.0f ? Vel.GetSafeNormal() : GetActorForwardVector();
+
+		// Async physics: applied at the next fixed step on the physics thread. GCs, and
+		// everything when the callback is off, take the game-thread path.
+		UCatAsyncPhysicsSubsystem* AsyncPhysics = UCatAsyncPhysicsSubsystem::GetActive(this);
+		UCatDestructibleSubsystem* Registry = UCatDestructibleSubsystem::Get(this);
+		const FVector Impulse = ImpulseDir * BumperPushForce;
+
+		for (const TWeakObjectPtr<UPrimitiveComponent>& Body : PendingBumperImpulses)
+		{
+			UPrimitiveComponent* Comp = Body.Get();
+			if (!Comp) continue;
+
+			// A shoved GC slides — re-bucket it until it comes to rest.
+			if (Registry && Comp->IsA<UGeometryCollectionComponent>())
+			{
+				Registry->NotifyMoving(Registry->GetId(Comp->GetOwner()));
+			}
+
+			if (!AsyncPhysics || !AsyncPhysics->QueueImpulse(Comp, Impulse))
+			{
+				Comp->AddImpulse(Impulse, NAME_None, /*bVelChange=*/false);
+			}
+		}
+		PendingBumperImpulses.Reset();
+	}
 
-	ForceShatterGC(GCC, Origin);
+	// Expired cooldowns — keeps the map to the handful of bodies touched recently.
+	if (!BumperContactTimes.IsEmpty())
+	{
+		const double Cutoff = GetWorld()->GetTimeSeconds() - BumperContactCooldown;
+		for (auto It = BumperContactTimes.CreateIterator(); It; ++It)
+		{
+			if (It.Value() < Cutoff || !It.Key().IsValid())
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+}
+
+float ACatBase::GetBumperStrain() const
+{
+	// Evaluated on the server for client hits — the authoritative pawn's speed, not the client's claim.
+	const float Speed = GetVelocity().Size2D();
+	return BumperChaosImpulse * FMath::Clamp(Speed / BumperStrainReferenceSpeed, 0.0f, BumperMaxStrainScale);
 }
 
 void ACatBase::ForceShatterGC(UGeometryCollectionComponent* GCC, FVector HitLocation)
@@ -215,6 +403,93 @@ void ACatBase::ForceShatterGC(UGeometryCollectionComponent* GCC, FVector HitLoca
 		/*PropagationFactor=*/ 1.0f,
 		/*Strain=*/            ShatterStrain
 	);
+
+	if (UCatDebrisSubsystem* Debris = UCatDebrisSubsystem::Get(GCC))
+	{
+		Debris->TrackCollection(GCC);
+	}
+}
+
+void ACatBase::ApplyGradedFracture(UGeometryCollectionComponent* GCC, FVector HitLocation, float Radius, float Strain)
+{
+	if (!GCC || Strain <= 0.0f) return;
+
+	// Levels the strain clears, counted from the root down. Level 0 not cleared → nothing
+	// would break, so skip waking the GC at all.
+	int32 PropagationDepth = 1;
+	if (const UGeometryCollection* Rest = GCC->GetRestCollection())
+	{
+		const TArray<float>& Thresholds = Rest->DamageThreshold;
+		if (Thresholds.Num() > 0)
+		{
+			PropagationDepth = 0;
+			while (PropagationDepth < Thresholds.Num() && Strain >= Thresholds[PropagationDepth])
+			{
+				++PropagationDepth;
+			}
+			if (PropagationDepth == 0) return;
+		}
+	}
+
+	// Nearest still-active cluster under the footprint — the one the bumper actually touched.
+	FGeometryDynamicCollection* DynCollection = GCC->GetDynamicCollection();
+	if (!DynCollection) return;
+
+	FGeometryCollectionDynamicStateFacade StateFacade(*DynCollection);
+	const TArray<FTransform3f>& Transforms = GCC->GetComponentSpaceTransforms3f();
+	const FVector LocalHit = GCC->GetComponentTransform().InverseTransformPosition(HitLocation);
+	const float RadiusSq = FMath::Square(Radius);
+
+	int32 ClusterIndex = INDEX_NONE;
+	float BestDistSq = RadiusSq;
+	bool bAnyActiveCluster = false;
+
+	for (int32 i = 0; i < Transforms.Num(); ++i)
+	{
+		if (!StateFacade.HasChildren(i) || !StateFacade.IsActive(i)) continue;
+		bAnyActiveCluster = true;
+
+		const float DistSq = FVector::DistSquared(FVector(Transforms[i].GetLocation()), LocalHit);
+		if (DistSq <= BestDistSq)
+		{
+			BestDistSq = DistSq;
+			ClusterIndex = i;
+		}
+	}
+
+	// Every cluster already released — nothing left to break. Flag it so the bumper stops
+	// reporting contacts with the loose fragments.
+	if (!bAnyActiveCluster)
+	{
+		if (UCatDestructibleSubsystem* Registry = UCatDestructibleSubsystem::Get(GCC))
+		{
+			Registry->MarkShattered(Registry->GetId(GCC->GetOwner()));
+		}
+	}
+
+	if (ClusterIndex == INDEX_NONE) return;
+
+	// Wake only the footprint, not the whole GC.
+	GCC->ApplyKinematicField(Radius, HitLocation);
+	GCC->ApplyExternalStrain(
+		/*ItemIndex=*/         ClusterIndex,
+		/*Location=*/          HitLocation,
+		/*Radius=*/            Radius,
+		/*PropagationDepth=*/  PropagationDepth,
+		/*PropagationFactor=*/ 1.0f,
+		/*Strain=*/            Strain
+	);
+
+	if (UCatDebrisSubsystem* Debris = UCatDebrisSubsystem::Get(GCC))
+	{
+		Debris->TrackCollection(GCC);
+	}
+
+	// The intact remainder can be knocked loose by its own debris.
+	if (UCatDestructibleSubsystem* Registry = UCatDestructibleSubsystem::Get(GCC))
+	{
+		Registry->NotifyMoving(Registry->GetId(GCC->GetOwner()));
+	}
 }
 
 void ACatBase::Tick(float DeltaTime)
@@ -223,9 +498,24 @@ void ACatBase::Tick(float DeltaTime)
 
 	DeltaTimeCached = DeltaTime;
 
+	// ── Bumper: apply last frame's merged push impulses ────────────────
+	FlushBumperImpulses();
+
+	// ── Bumper: GC contacts from the registry, where a push or fracture can come from ──
+	if (HasAuthority() || IsLocallyControlled())
+	{
+		QueryBumperDestructibles();
+	}
+
 	// ── State: runs on ALL roles (server, autonomous, simulated) ──
 	UpdateAnimationStates();
 
+	// ── Ragdoll: capsule follows the pelvis, clients steer toward server state ──
+	if (bIsRagdoll)
+	{
+		UpdateRagdoll(DeltaTime);
+	}
+
 	// ── Jump gravity: authority + autonomous proxy only ────────────────
 	UpdateJumpGravity();
 
@@ -235,6 +525,27 @@ void ACatBase::Tick(float DeltaTime)
 		UpdateGrab(DeltaTime);
 	}
 
+	// ── Grab candidate: owning client keeps the target a bite would take ──
+	if (IsLocallyControlled())
+	{
+		UpdateGrabCandidate(DeltaTime);
+	}
+
+	// ── Held body: owner streams it, followers track the stream ──
+	if (bIsGrabbing)
+	{
+		UpdateHeldBody(DeltaTime);
+
+		// A carried GC moves with the cat — keep its registry hash cell current.
+		if (const UGeometryCollectionComponent* HeldGC = Cast<UGeometryCollectionComponent>(GrabbedComponent.Get()))
+		{
+			if (UCatDestructibleSubsystem* Registry = UCatDestructibleSubsystem::Get(this))
+			{
+				Registry->NotifyMoving(Registry->GetId(HeldGC->GetOwner()));
+			}
+		}
+	}
+
 	// ── Turn-In-Place Rotation Commitment ─────────────────────────────
 	// Runs BEFORE cosmetic interp so next frame's AimYaw sees the
 	// already-committed actor rotation — eliminates one-frame snap.
@@ -246,8 +557,8 @@ void ACatBase::Tick(float DeltaTime)
 		//   2. Server copy of client pawn (HasAuthority && !IsLocallyControlled) — so the
 		//      authoritative actor rotation matches the turn animation, preventing pop.
 		// Simulated proxies receive the replicated rotation automatically.
-		const bool bIsLocalTurn  = bGoTurn && IsLocallyControlled();
-		const bool bIsServerTurn = bGoTurn && HasAuthority() && !IsLocallyControlled();
+		const bool bIsLocalTurn  = bGoTurn && !bIsRagdoll && IsLocallyControlled();
+		const bool bIsServerTurn = bGoTurn && !bIsRagdoll && HasAuthority() && !IsLocallyControlled();
 
 		if (bIsLocalTurn || bIsServerTurn)
 		{
@@ -319,7 +630,7 @@ void ACatBase::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
 		EnhancedInput->BindAction(JumpAction,   ETriggerEvent::Completed, this, &ACharacter::StopJumping);
 
 		// Meow
-		EnhancedInput->BindAction(MeowAction,   ETriggerEvent::Started,   this, &ACatBase::Server_Meow);
+		EnhancedInput->BindAction(MeowAction,   ETriggerEvent::Started,   this, &ACatBase::TriggerMeow);
 
 		// Swat
 		EnhancedInput->BindAction(SwatAction,   ETriggerEvent::Started,   this, &ACatBase::TriggerSwat);
@@ -339,6 +650,8 @@ void ACatBase::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
 
 void ACatBase::Move(const FInputActionValue& Value)
 {
+	if (bIsRagdoll) return;
+
 	const FVector2D MoveInput = Value.Get<FVector2D>();
 
 	if (Controller)
@@ -368,14 +681,30 @@ void ACatBase::Look(const FInputActionValue& Value)
 // ── Networked Meow ──────────────────────────────────────────────────────
 // ══════════════════════════════════════════════════════════════════════════
 
-void ACatBase::Server_Meow_Implementation()
+void ACatBase::TriggerMeow()
+{
+	UCatLatencySubsystem* Latency = UCatLatencySubsystem::Get(this);
+	Server_Meow(Latency ? Latency->BeginProbe() : 0);
+}
+
+void ACatBase::Server_Meow_Implementation(uint16 ProbeId)
 {
-	NetMulticast_Meow();
+	NetMulticast_Meow(ProbeId);
 }
 
-void ACatBase::NetMulticast_Meow_Implementation()
+void ACatBase::NetMulticast_Meow_Implementation(uint16 ProbeId)
 {
 	OnMeow.Broadcast();
+
+	// The owning client's probe resolves when its own meow comes back around. Rapid meows
+	// each carry their own id, so an early broadcast can't close a later probe.
+	if (ProbeId != 0 && IsLocallyControlled())
+	{
+		if (UCatLatencySubsystem* Latency = UCatLatencySubsystem::Get(this))
+		{
+			Latency->MarkStage(ProbeId, ECatLatencyStage::MeowBroadcast);
+		}
+	}
 }
 
 // ══════════════════════════════════════════════════════════════════════════
@@ -384,17 +713,30 @@ void ACatBase::NetMulticast_Meow_Implementation()
 
 void ACatBase::TriggerSwat()
 {
-	if (bIsSwatting) return;
+	if (bIsSwatting || bIsRagdoll) return;
+
+	UCatLatencySubsystem* Latency = UCatLatencySubsystem::Get(this);
+	const uint16 ProbeId = Latency ? Latency->BeginProbe() : 0;
 
 	// Local prediction: play montage immediately
 	PlaySwatMontageAndBindEnd();
 
+	if (Latency && bIsSwatting)
+	{
+		Latency->MarkStage(ProbeId, ECatLatencyStage::SwatMontageStart);
+	}
+
 	// Tell the server
-	Server_Swat();
+	Server_Swat(ProbeId);
 }
 
-void ACatBase::Server_Swat_Implementation()
+void ACatBase::Server_Swat_Implementation(uint16 ProbeId)
 {
+	// Held until the montage ends so HandleSwatHit can ack the hit and impulse stages.
+	ActiveSwatProbeId  = ProbeId;
+	bSwatProbeHitAcked = false;
+	AckLatencyProbe(ProbeId, ECatLatencyStage::SwatServerAck);
+
 	// Multicast to all *other* machines (the instigator already predicted)
 	Multicast_Swat();
 }
@@ -426,11 +768,12 @@ void ACatBase::PlaySwatMontageAndBindEnd()
 void ACatBase::OnSwatMontageEnded(UAnimMontage* Montage, bool bInterrupted)
 {
 	bIsSwatting = false;
+	ActiveSwatProbeId = 0;
 }
 
 void ACatBase::BeginSwatTrace(USkeletalMeshComponent* MeshComp, FName SocketName)
 {
-	if (!HasAuthority()) return;
+	if (!HasAuthority() && !IsLocallyControlled()) return;
 
 	SwatPreviousPawLocation = MeshComp->GetSocketLocation(SocketName);
 	SwatAlreadyHitActors.Empty();
@@ -438,7 +781,7 @@ void ACatBase::BeginSwatTrace(USkeletalMeshComponent* MeshComp, FName SocketName
 
 void ACatBase::ProcessSwatTraceTick(USkeletalMeshComponent* MeshComp, FName SocketName, float SweepRadius, float DeltaSeconds)
 {
-	if (!HasAuthority()) return;
+	if (!HasAuthority() && !IsLocallyControlled()) return;
 
 	const FVector CurrentPawLocation = MeshComp->GetSocketLocation(SocketName);
 
@@ -463,7 +806,14 @@ void ACatBase::ProcessSwatTraceTick(USkeletalMeshComponent* MeshComp, FName Sock
 		if (HitResult.GetActor() && !SwatAlreadyHitActors.Contains(HitResult.GetActor()))
 		{
 			SwatAlreadyHitActors.Add(HitResult.GetActor());
-			HandleSwatHit(HitResult);
+			if (HasAuthority())
+			{
+				HandleSwatHit(HitResult);
+			}
+			else
+			{
+				PredictSwatImpulse(HitResult);
+			}
 		}
 	}
 
@@ -472,7 +822,7 @@ void ACatBase::ProcessSwatTraceTick(USkeletalMeshComponent* MeshComp, FName Sock
 
 void ACatBase::EndSwatTrace()
 {
-	if (!HasAuthority()) return;
+	if (!HasAuthority() && !IsLocallyControlled()) return;
 
 	SwatAlreadyHitActors.Empty();
 }
@@ -488,16 +838,27 @@ void ACatBase::HandleSwatHit(const FHitResult& HitResult)
 
 	const FVector ImpulseDir = (HitActor->GetActorLocation() - GetActorLocation()).GetSafeNormal();
 
+	if (!bSwatProbeHitAcked)
+	{
+		bSwatProbeHitAcked = true;
+		AckLatencyProbe(ActiveSwatProbeId, ECatLatencyStage::SwatServerHit);
+	}
+
 	// Apply impulse to physics objects
 	if (UPrimitiveComponent* HitComp = HitResult.GetComponent())
 	{
 		if (HitComp->IsSimulatingPhysics())
 		{
 			HitComp->AddImpulse(ImpulseDir * SwatImpulseForce, NAME_None, /*bVelChange=*/false);
+
+			// One sample per probe — a swipe through a stack would otherwise ack every body.
+			// SwatServerHit has already fired by now, so the probe is done on the server.
+			AckLatencyProbe(ActiveSwatProbeId, ECatLatencyStage::SwatImpulse);
+			ActiveSwatProbeId = 0;
 		}
 	}
 
-	// Send 1 point of damage with the swat direction. The receiver (e.g. BPC_ChaosItem)
+	// Send 1 point of damage with the swat direction. The receiver (e.g. UCatChaosItemComponent)
 	// decides how to respond — the Cat has no knowledge of GC or destruction logic.
 	const float DamageDealt = UGameplayStatics::ApplyPointDamage(
 		HitActor,
@@ -516,6 +877,41 @@ void ACatBase::HandleSwatHit(const FHitResult& HitResult)
 	OnSwatHit.Broadcast(HitActor, HitResult.ImpactPoint);
 }
 
+void ACatBase::PredictSwatImpulse(const FHitResult& HitResult)
+{
+	const AActor* HitActor = HitResult.GetActor();
+	UPrimitiveComponent* HitComp = HitResult.GetComponent();
+	if (!HitActor || !HitComp || !HitComp->IsSimulatingPhysics()) return;
+
+	// Props on default replication would snap straight back — leave those to the server.
+	if (!UCatPhysicsPropSubsystem::IsPredictedProp(HitComp)) return;
+
+	// Same direction and force HandleSwatHit applies on the server.
+	const FVector ImpulseDir = (HitActor->GetActorLocation() - GetActorLocation()).GetSafeNormal();
+	HitComp->AddImpulse(ImpulseDir * SwatImpulseForce, NAME_None, /*bVelChange=*/false);
+	INC_DWORD_STAT(STAT_CatPredictedImpulses);
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// ── Latency Probes ──────────────────────────────────────────────────────
+// ══════════════════════════════════════════════════════════════════════════
+
+void ACatBase::AckLatencyProbe(uint16 ProbeId, ECatLatencyStage Stage)
+{
+	if (ProbeId == 0) return;
+
+	// On the listen-server host's own cat this Client RPC executes locally.
+	Client_LatencyProbeAck(ProbeId, Stage);
+}
+
+void ACatBase::Client_LatencyProbeAck_Implementation(uint16 ProbeId, ECatLatencyStage Stage)
+{
+	if (UCatLatencySubsystem* Latency = UCatLatencySubsystem::Get(this))
+	{
+		Latency->MarkStage(ProbeId, Stage);
+	}
+}
+
 // ══════════════════════════════════════════════════════════════════════════
 // ── Interaction ─────────────────────────────────────────────────────────
 // ══════════════════════════════════════════════════════════════════════════
@@ -564,17 +960,25 @@ void ACatBase::PerformInteractTrace()
 
 void ACatBase::TriggerGrab()
 {
+	if (bIsRagdoll) return;
+
 	// Client-side prediction: apply drag settings immediately so there is no
 	// rubber-band stutter waiting for the server round-trip.
 	ApplyDragMovementSettings();
 
+	if (UCatLatencySubsystem* Latency = UCatLatencySubsystem::Get(this))
+	{
+		PendingGrabProbeId = Latency->BeginProbe();
+	}
+
+	UPrimitiveComponent* Candidate = GrabCandidate.Get();
 	if (HasAuthority())
 	{
-		Server_Grab_Implementation();
+		Server_Grab_Implementation(PendingGrabProbeId, Candidate, GrabCandidateBoneIndex);
 	}
 	else
 	{
-		Server_Grab();
+		Server_Grab(PendingGrabProbeId, Candidate, GrabCandidateBoneIndex);
 	}
 }
 
@@ -593,108 +997,272 @@ void ACatBase::TriggerRelease()
 	}
 }
 
-void ACatBase::Server_Grab_Implementation()
+void ACatBase::Server_Grab_Implementation(uint16 ProbeId, UPrimitiveComponent* Candidate, int16 BoneIndex)
 {
-	if (bIsGrabbing) return;
-
-	const FTransform MouthTransform = GetMesh()->GetSocketTransform(TEXT("socket_mouth"));
-	const FVector    TraceStart     = MouthTransform.GetLocation();
-	const FVector    TraceEnd       = TraceStart + MouthTransform.GetUnitAxis(EAxis::X) * GrabTraceLength;
+	AckLatencyProbe(ProbeId, ECatLatencyStage::GrabServerAck);
 
-	FHitResult HitResult;
-	FCollisionQueryParams Params;
-	Params.AddIgnoredActor(this);
+	if (bIsGrabbing) return;
 
-	// Sweep against physics bodies (SM), destructibles (GC), and world dynamic actors.
-	FCollisionObjectQueryParams ObjParams;
-	ObjParams.AddObjectTypesToQuery(ECC_PhysicsBody);
-	ObjParams.AddObjectTypesToQuery(ECC_Destructible);
-	ObjParams.AddObjectTypesToQuery(ECC_WorldDynamic);
+	if (!Candidate)
+	{
+		if (GEngine) GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::Red, TEXT("Grab: MISS — nothing in reach"));
+		return;
+	}
 
-	const bool bHit = GetWorld()->SweepSingleByObjectType(
-		HitResult,
-		TraceStart,
-		TraceEnd,
-		FQuat::Identity,
-		ObjParams,
-		FCollisionShape::MakeSphere(GrabTraceRadius),
-		Params);
+	// The candidate is the client's word — never our own mesh or anything we own.
+	const AActor* CandidateOwner = Candidate->GetOwner();
+	if (!CandidateOwner || CandidateOwner->IsOwnedBy(this))
+	{
+		if (GEngine) GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::Red,
+			FString::Printf(TEXT("Grab: REJECTED — '%s' is not grabbable"), *GetNameSafe(CandidateOwner)));
+		return;
+	}
 
-	// Debug: draw the sweep volume regardless of result.
-	if (bHit)
+	// Grabbable: a simulating body, or an intact registered GC (which may still be asleep
+	// until the kinematic field below wakes it). Checked before anything touches the solver.
+	UGeometryCollectionComponent* GCC = Cast<UGeometryCollectionComponent>(Candidate);
+	bool bGrabbable = Candidate->IsSimulatingPhysics();
+	if (GCC)
 	{
-		DrawDebugSphere(GetWorld(), HitResult.ImpactPoint, GrabTraceRadius, 12, FColor::Green, false, 3.0f);
+		const UCatDestructibleSubsystem* Registry = UCatDestructibleSubsystem::Get(this);
+		const FCatDestructibleEntry* Entry = Registry ? Registry->Find(Registry->GetId(CandidateOwner)) : nullptr;
+		bGrabbable = Entry && !Entry->bShattered && Entry->GCC.Get() == GCC;
 	}
-	else
+	if (!bGrabbable)
 	{
-		DrawDebugLine(GetWorld(), TraceStart, TraceEnd, FColor::Red, false, 3.0f, 0, 1.5f);
-		DrawDebugSphere(GetWorld(), TraceEnd, GrabTraceRadius, 12, FColor::Red, false, 3.0f);
-		if (GEngine) GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::Red, TEXT("Grab: MISS — nothing in reach"));
+		if (GEngine) GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::Orange,
+			FString::Printf(TEXT("Grab: FAILED — '%s' not simulating physics"), *GetNameSafe(CandidateOwner)));
 		return;
 	}
 
-	UPrimitiveComponent* HitComp = HitResult.GetComponent();
-	if (!HitComp)
+	// Reach check against the candidate's nearest surface. The client chose it from a pose
+	// up to a round trip newer than ours, hence the slack. GCs don't answer closest-point
+	// queries — fall back to their bounds sphere.
+	const FVector Mouth = GetMesh()->GetSocketLocation(TEXT("socket_mouth"));
+	FVector NearestPoint;
+	float Distance = Candidate->GetClosestPointOnCollision(Mouth, NearestPoint);
+	if (Distance < 0.0f)
 	{
-		if (GEngine) GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::Red, TEXT("Grab: MISS — null component"));
+		const FBoxSphereBounds& Bounds = Candidate->Bounds;
+		const FVector ToMouth = Mouth - Bounds.Origin;
+		Distance     = FMath::Max(0.0f, static_cast<float>(ToMouth.Size() - Bounds.SphereRadius));
+		NearestPoint = Bounds.Origin + ToMouth.GetClampedToMaxSize(Bounds.SphereRadius);
+	}
+
+	const float MaxReach = GrabTraceLength + GrabTraceRadius + GrabCandidateReachSlack;
+	if (Distance > MaxReach)
+	{
+		if (GEngine) GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::Red,
+			FString::Printf(TEXT("Grab: REJECTED — '%s' %.0f cm from mouth (max %.0f)"),
+				*GetNameSafe(Candidate->GetOwner()), Distance, MaxReach));
 		return;
 	}
 
 	// For Geometry Collections: wake the Chaos solver on the SERVER before the
-	// IsSimulatingPhysics() check. The multicast will wake on all other machines.
-	if (UGeometryCollectionComponent* GCC = Cast<UGeometryCollectionComponent>(HitComp))
+	// IsSimulatingPhysics() check. Each client wakes its own copy when it binds.
+	if (GCC)
 	{
-		GCC->ApplyKinematicField(GrabTraceRadius * 2.0f, HitResult.ImpactPoint);
+		GCC->ApplyKinematicField(GrabTraceRadius * 2.0f, NearestPoint);
 	}
 
-	if (!HitComp->IsSimulatingPhysics())
+	if (!Candidate->IsSimulatingPhysics())
 	{
 		if (GEngine) GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::Orange,
-			FString::Printf(TEXT("Grab: FAILED — '%s' not simulating physics"), *HitComp->GetOwner()->GetName()));
+			FString::Printf(TEXT("Grab: FAILED — '%s' not simulating physics"), *GetNameSafe(Candidate->GetOwner())));
 		return;
 	}
 
-	// Determine the bone to constrain. GC → root cluster (NAME_None) to avoid
-	// crashing on individual cluster particles that lack rigid body handles.
-	FName ConstraintBone = HitResult.BoneName;
-	if (HitComp->IsA<UGeometryCollectionComponent>())
+	// Only skinned meshes have bones worth naming — anything else, or an index the mesh
+	// doesn't have, constrains the root body.
+	const USkinnedMeshComponent* Skinned = Cast<USkinnedMeshComponent>(Candidate);
+	if (!Skinned || BoneIndex < 0 || BoneIndex >= Skinned->GetNumBones())
 	{
-		ConstraintBone = NAME_None;
+		BoneIndex = INDEX_NONE;
 	}
 
 	if (GEngine) GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::Green,
-		FString::Printf(TEXT("Grab: OK — multicast constraint on '%s' bone '%s'"),
-			*HitComp->GetOwner()->GetName(), *ConstraintBone.ToString()));
+		FString::Printf(TEXT("Grab: OK — constraint on '%s' bone %d"),
+			*GetNameSafe(Candidate->GetOwner()), BoneIndex));
 
-	// Server validated the trace — now multicast so ALL machines create their own
-	// local constraint and modify their own Chaos solver state.
-	Multicast_Grab(HitComp, ConstraintBone);
+	// Server validated the candidate — publish it. Every machine binds its own local
+	// constraint and modifies its own Chaos solver state when GrabState arrives.
+	SetGrabState(Candidate, BoneIndex);
 }
 
-void ACatBase::Multicast_Grab_Implementation(UPrimitiveComponent* GrabbedComp, FName BoneName)
+int16 ACatBase::GetGrabBoneIndex(const UPrimitiveComponent* Comp, FName HitBone)
 {
-	if (!GrabbedComp) return;
+	// Bones cross the wire as a skeleton index, not an FName. GCs constrain the root
+	// cluster — individual cluster particles lack rigid body handles.
+	if (const USkinnedMeshComponent* Skinned = Cast<USkinnedMeshComponent>(Comp))
+	{
+		return static_cast<int16>(Skinned->GetBoneIndex(HitBone));
+	}
+	return INDEX_NONE;
+}
 
-	// Create the constraint dynamically on this machine's physics solver.
-	GrabConstraint = NewObject<UPhysicsConstraintComponent>(this, TEXT("GrabConstraint"));
-	GrabConstraint->SetupAttachment(GrabTargetLocation);
-	GrabConstraint->RegisterComponent();
+void ACatBase::UpdateGrabCandidate(float DeltaTime)
+{
+	UWorld* World = GetWorld();
 
-	// Linear: limited slack + position/velocity drive toward anchor.
-	GrabConstraint->SetLinearXLimit(ELinearConstraintMotion::LCM_Limited, GrabLinearLimit);
-	GrabConstraint->SetLinearYLimit(ELinearConstraintMotion::LCM_Limited, GrabLinearLimit);
-	GrabConstraint->SetLinearZLimit(ELinearConstraintMotion::LCM_Limited, GrabLinearLimit);
-	GrabConstraint->SetLinearPositionDrive(true, true, true);
-	GrabConstraint->SetLinearVelocityDrive(true, true, true);
-	GrabConstraint->SetLinearDriveParams(GrabConstraintStiffness, GrabConstraintDamping, GrabConstraintMaxForce);
+	// ── Collect: last frame's sweep. Hits arrive nearest first. ──
+	if (GrabCandidateHandle.IsValid())
+	{
+		FTraceDatum Datum;
+		if (World->QueryTraceData(GrabCandidateHandle, Datum))
+		{
+			UPrimitiveComponent* Best = nullptr;
+			FName BestBone = NAME_None;
+			float BestDistance = TNumericLimits<float>::Max();
+			for (const FHitResult& Hit : Datum.OutHits)
+			{
+				UPrimitiveComponent* HitComp = Hit.GetComponent();
+				if (HitComp && HitComp->IsSimulatingPhysics())
+				{
+					Best = HitComp;
+					BestBone = Hit.BoneName;
+					BestDistance = Hit.Distance;
+					break;
+				}
+			}
 
-	// Angular: free — let the object tumble naturally while being dragged.
-	GrabConstraint->SetAngularSwing1Limit(EAngularConstraintMotion::ACM_Free, 0.0f);
-	GrabConstraint->SetAngularSwing2Limit(EAngularConstraintMotion::ACM_Free, 0.0f);
-	GrabConstraint->SetAngularTwistLimit(EAngularConstraintMotion::ACM_Free, 0.0f);
+			// GCs come from the registry along the same segment. They may be asleep until the
+			// server's kinematic field wakes them, so they don't need to be simulating.
+			float GCDistance = 0.0f;
+			if (UGeometryCollectionComponent* GCC = FindGrabbableDestructible(Datum.Start, Datum.End, GCDistance))
+			{
+				if (GCDistance < BestDistance)
+				{
+					Best = GCC;
+					BestBone = NAME_None;
+				}
+			}
 
-	// Disable collision between constrained bodies to prevent jitter.
-	GrabConstraint->SetDisableCollision(true);
+			SetGrabCandidate(Best, Best ? GetGrabBoneIndex(Best, BestBone) : static_cast<int16>(INDEX_NONE));
+		}
+		GrabCandidateHandle = FTraceHandle();
+	}
+
+	// Nothing to offer while the jaw is busy.
+	if (bIsGrabbing || bIsRagdoll)
+	{
+		SetGrabCandidate(nullptr, INDEX_NONE);
+		GrabCandidateElapsed = 0.0f;
+		return;
+	}
+
+	// ── Issue: throttled, resolved next frame off the game thread ──
+	GrabCandidateElapsed += DeltaTime;
+	if (GrabCandidateElapsed < 1.0f / GrabCandidateQueryRate) return;
+	GrabCandidateElapsed = 0.0f;
+
+	const FTransform MouthTransform = GetMesh()->GetSocketTransform(TEXT("socket_mouth"));
+	const FVector    TraceStart     = MouthTransform.GetLocation();
+	const FVector    TraceEnd       = TraceStart + MouthTransform.GetUnitAxis(EAxis::X) * GrabTraceLength;
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(CatGrabCandidate), /*bTraceComplex=*/false, this);
+
+	// Physics bodies (SM) and world dynamic actors. GCs are found through the registry on collect.
+	FCollisionObjectQueryParams ObjParams;
+	ObjParams.AddObjectTypesToQuery(ECC_PhysicsBody);
+	ObjParams.AddObjectTypesToQuery(ECC_WorldDynamic);
+
+	GrabCandidateHandle = World->AsyncSweepByObjectType(
+		EAsyncTraceType::Multi, TraceStart, TraceEnd, FQuat::Identity, ObjParams,
+		FCollisionShape::MakeSphere(GrabTraceRadius), Params);
+}
+
+UGeometryCollectionComponent* ACatBase::FindGrabbableDestructible(const FVector& Start, const FVector& End, float& OutDistance) const
+{
+	const UCatDestructibleSubsystem* Registry = UCatDestructibleSubsystem::Get(this);
+	if (!Registry) return nullptr;
+
+	const float HalfLength = FVector::Dist(Start, End) * 0.5f;
+	TArray<uint32> Nearby;
+	Registry->QueryRadius((Start + End) * 0.5f, HalfLength + GrabTraceRadius, Nearby);
+
+	UGeometryCollectionComponent* Best = nullptr;
+	OutDistance = TNumericLimits<float>::Max();
+
+	for (const uint32 Id : Nearby)
+	{
+		const FCatDestructibleEntry* Entry = Registry->Find(Id);
+		UGeometryCollectionComponent* GCC = Entry && !Entry->bShattered ? Entry->GCC.Get() : nullptr;
+		if (!GCC) continue;
+
+		// Same bounds-sphere test Server_Grab validates with.
+		const FBoxSphereBounds& Bounds = GCC->Bounds;
+		if (FMath::PointDistToSegment(Bounds.Origin, Start, End) > Bounds.SphereRadius + GrabTraceRadius) continue;
+
+		const float Distance = FMath::Max(0.0f, static_cast<float>(FVector::Dist(Bounds.Origin, Start) - Bounds.SphereRadius));
+		if (Distance < OutDistance)
+		{
+			OutDistance = Distance;
+			Best = GCC;
+		}
+	}
+
+	return Best;
+}
+
+void ACatBase::SetGrabCandidate(UPrimitiveComponent* Candidate, int16 BoneIndex)
+{
+	GrabCandidateBoneIndex = BoneIndex;
+	if (GrabCandidate.Get() == Candidate) return;
+
+	GrabCandidate = Candidate;
+	OnGrabCandidateChanged.Broadcast(Candidate);
+}
+
+void ACatBase::SetGrabState(UPrimitiveComponent* Target, int16 BoneIndex)
+{
+	check(HasAuthority());
+
+	GrabState.Target    = Target;
+	GrabState.BoneIndex = Target ? BoneIndex : static_cast<int16>(INDEX_NONE);
+	GrabState.bOwnerSimulated = Target && ShouldOwnerSimulate(Target);
+	++GrabState.Sequence;
+
+	ApplyGrabState();
+	ForceNetUpdate();
+}
+
+void ACatBase::OnRep_GrabState()
+{
+	ApplyGrabState();
+}
+
+void ACatBase::ApplyGrabState()
+{
+	// Target may still be unmapped on a client (its actor not yet relevant); the rep
+	// layer calls OnRep_GrabState again once the GUID resolves.
+	UPrimitiveComponent* Target = GrabState.Target;
+
+	const bool bUpToDate = AppliedGrabSequence == GrabState.Sequence
+		&& GrabbedComponent.Get() == Target
+		&& bIsGrabbing == (Target != nullptr);
+	if (bUpToDate) return;
+
+	AppliedGrabSequence = GrabState.Sequence;
+
+	if (bIsGrabbing)
+	{
+		ReleaseGrabLocal();
+	}
+	if (Target)
+	{
+		BindGrab(Target, GrabState.BoneIndex);
+	}
+}
+
+void ACatBase::BindGrab(UPrimitiveComponent* GrabbedComp, int16 BoneIndex)
+{
+	FName BoneName = NAME_None;
+	if (const USkinnedMeshComponent* Skinned = Cast<USkinnedMeshComponent>(GrabbedComp))
+	{
+		BoneName = BoneIndex != INDEX_NONE ? Skinned->GetBoneName(BoneIndex) : NAME_None;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_CatGrabBind);
 
 	// Snap the constraint to the grab target offset (80 cm ahead of socket_mouth).
 	GrabConstraint->SetWorldLocation(GrabTargetLocation->GetComponentLocation());
@@ -702,8 +1270,32 @@ void ACatBase::Multicast_Grab_Implementation(UPrimitiveComponent* GrabbedComp, F
 	// Wake the target body on THIS machine's solver before binding the constraint.
 	GrabbedComp->WakeRigidBody(BoneName);
 
-	// Anchor to this machine's local capsule physics body → grabbed component.
-	GrabConstraint->SetConstrainedComponents(GetCapsuleComponent(), NAME_None, GrabbedComp, BoneName);
+	// Owner-simulated grabs: only the owning client constrains the body to its capsule.
+	// Everyone else — the server included — follows the owner's stream, with gravity off
+	// so their copy doesn't sag between samples.
+	bFollowingHeldBody = GrabState.bOwnerSimulated && !IsLocallyControlled();
+	HeldBodySendElapsed = 0.0f;
+	HeldBodyStateReceiveTime = 0.0;
+
+	if (bFollowingHeldBody)
+	{
+		GrabbedComp->SetEnableGravity(false);
+	}
+	else
+	{
+		// Anchor to this machine's local capsule physics body → grabbed component.
+		GrabConstraint->SetConstrainedComponents(GetCapsuleComponent(), NAME_None, GrabbedComp, BoneName);
+	}
+
+	// The simulating owner must not snap to the server's copy of the body, which only
+	// echoes this client's own samples back a round trip late.
+	AActor* HeldActor = GrabbedComp->GetOwner();
+	if (GrabState.bOwnerSimulated && IsLocallyControlled() && !HasAuthority()
+		&& HeldActor && HeldActor->IsReplicatingMovement())
+	{
+		HeldActor->SetReplicatingMovement(false);
+		SuspendedMovementActor = HeldActor;
+	}
 
 	// Suppress collision-based strain on THIS machine's Chaos solver while dragging.
 	if (UGeometryCollectionComponent* GCC = Cast<UGeometryCollectionComponent>(GrabbedComp))
@@ -714,63 +1306,219 @@ void ACatBase::Multicast_Grab_Implementation(UPrimitiveComponent* GrabbedComp, F
 	GrabbedComponent = GrabbedComp;
 	bIsGrabbing      = true;
 	ApplyDragMovementSettings();
+
+	if (PendingGrabProbeId != 0 && IsLocallyControlled())
+	{
+		if (UCatLatencySubsystem* Latency = UCatLatencySubsystem::Get(this))
+		{
+			Latency->MarkStage(PendingGrabProbeId, ECatLatencyStage::GrabConstraint);
+		}
+		PendingGrabProbeId = 0;
+	}
 }
 
 void ACatBase::Server_ReleaseGrab_Implementation()
 {
-	Multicast_ReleaseGrab();
+	if (GrabState.Target)
+	{
+		SetGrabState(nullptr, INDEX_NONE);
+	}
 }
 
-void ACatBase::Multicast_ReleaseGrab_Implementation()
+void ACatBase::ReleaseGrabLocal()
 {
-	// Re-enable collision strain on THIS machine's Chaos solver.
+	// Re-enable collision strain on THIS machine's Chaos solver. A dropped or thrown GC is
+	// still moving — keep re-bucketing it until it lands.
 	if (UGeometryCollectionComponent* GCC = Cast<UGeometryCollectionComponent>(GrabbedComponent.Get()))
 	{
 		GCC->SetEnableDamageFromCollision(true);
+
+		if (UCatDestructibleSubsystem* Registry = UCatDestructibleSubsystem::Get(this))
+		{
+			Registry->NotifyMoving(Registry->GetId(GCC->GetOwner()));
+		}
 	}
-	if (GrabConstraint)
+	// Authority returns to the server: its copy simply resumes simulating from the last
+	// accepted sample, so a throw carries the owner's release velocity.
+	if (bFollowingHeldBody && GrabbedComponent.IsValid())
 	{
-		GrabConstraint->DestroyComponent();
-		GrabConstraint = nullptr;
+		GrabbedComponent->SetEnableGravity(true);
 	}
+	bFollowingHeldBody = false;
+
+	if (AActor* HeldActor = SuspendedMovementActor.Get())
+	{
+		HeldActor->SetReplicatingMovement(true);
+	}
+	SuspendedMovementActor.Reset();
+
+	UnbindGrabConstraint();
 	GrabbedComponent.Reset();
 	bIsGrabbing = false;
 	RestoreNormalMovementSettings();
 }
 
+bool ACatBase::ShouldOwnerSimulate(const UPrimitiveComponent* Target) const
+{
+	// Only a remote owner gains anything: a listen-server host already simulates with
+	// authority. GCs stay server-simulated — their break strain is scored there — and
+	// skinned bodies would need every bone streamed, not one.
+	return CVarCatGrabOwnerSimulation.GetValueOnGameThread()
+		&& IsPlayerControlled()
+		&& !IsLocallyControlled()
+		&& !Target->IsA<UGeometryCollectionComponent>()
+		&& !Target->IsA<USkinnedMeshComponent>();
+}
+
+void ACatBase::UpdateHeldBody(float DeltaTime)
+{
+	UPrimitiveComponent* Held = GrabbedComponent.Get();
+	if (!Held || !GrabState.bOwnerSimulated) return;
+
+	// ── Owner: stream the local simulation, faster while it's moving ──
+	if (IsLocallyControlled())
+	{
+		if (HasAuthority()) return;
+
+		const FVector Velocity = Held->GetPhysicsLinearVelocity();
+		const float Alpha = FMath::Clamp(Velocity.Size() / HeldBodySendReferenceSpeed, 0.0f, 1.0f);
+		const float SendRate = FMath::Lerp(HeldBodyMinSendRate, FMath::Max(HeldBodyMaxSendRate, HeldBodyMinSendRate), Alpha);
+
+		HeldBodySendElapsed += DeltaTime;
+		if (HeldBodySendElapsed < 1.0f / SendRate) return;
+		HeldBodySendElapsed = 0.0f;
+
+		FCatHeldBodyState State;
+		State.Location        = Held->GetComponentLocation();
+		State.Rotation        = Held->GetComponentRotation();
+		State.LinearVelocity  = Velocity;
+		State.AngularVelocity = Held->GetPhysicsAngularVelocityInDegrees();
+		State.GrabSequence    = GrabState.Sequence;
+		Server_UpdateHeldBodyState(State);
+		return;
+	}
+
+	// ── Client followers: steer toward the extrapolated relay, as UpdateRagdoll does ──
+	// The server places its copy directly when each sample arrives.
+	if (HasAuthority() || !bFollowingHeldBody || HeldBodyStateReceiveTime <= 0.0) return;
+	if (HeldBodyState.GrabSequence != GrabState.Sequence) return;
+
+	constexpr double MaxExtrapolationSeconds = 0.25;
+	const double Age = FMath::Min(GetWorld()->GetTimeSeconds() - HeldBodyStateReceiveTime, MaxExtrapolationSeconds);
+	const FVector TargetLocation = HeldBodyState.Location + HeldBodyState.LinearVelocity * Age;
+	const FVector Error = TargetLocation - Held->GetComponentLocation();
+
+	if (Error.SizeSquared() > FMath::Square(HeldBodySnapDistance))
+	{
+		Held->SetWorldLocationAndRotation(TargetLocation, HeldBodyState.Rotation, false, nullptr, ETeleportType::TeleportPhysics);
+		Held->SetPhysicsLinearVelocity(HeldBodyState.LinearVelocity);
+	}
+	else
+	{
+		Held->SetPhysicsLinearVelocity(FVector(HeldBodyState.LinearVelocity) + Error * HeldBodyCorrectionGain);
+	}
+	Held->SetPhysicsAngularVelocityInDegrees(HeldBodyState.AngularVelocity);
+}
+
+void ACatBase::Server_UpdateHeldBodyState_Implementation(const FCatHeldBodyState& State)
+{
+	UPrimitiveComponent* Held = GrabbedComponent.Get();
+
+	// Late samples from a previous grab, or for a grab the server has since dropped.
+	if (!Held || !GrabState.bOwnerSimulated || State.GrabSequence != GrabState.Sequence) return;
+
+	// The owner may place the body anywhere it could legitimately hold it — no further.
+	// The server's copy of the capsule lags, so this is the same slack UpdateGrab allows.
+	if (FVector::DistSquared(State.Location, GrabTargetLocation->GetComponentLocation()) > FMath::Square(MaxGrabDistance))
+	{
+		INC_DWORD_STAT(STAT_CatHeldBodyRejected);
+		return;
+	}
+
+	Held->SetWorldLocationAndRotation(State.Location, State.Rotation, false, nullptr, ETeleportType::TeleportPhysics);
+	Held->SetPhysicsLinearVelocity(State.LinearVelocity);
+	Held->SetPhysicsAngularVelocityInDegrees(State.AngularVelocity);
+
+	HeldBodyState = State;
+}
+
+void ACatBase::OnRep_HeldBodyState()
+{
+	HeldBodyStateReceiveTime = GetWorld()->GetTimeSeconds();
+}
+
 void ACatBase::UpdateGrab(float DeltaTime)
 {
 	if (!bIsGrabbing) return;
 
-	// Local cleanup: if the grabbed actor was destroyed on this machine, tear down
-	// the local constraint immediately. No multicast needed — each machine detects
-	// destruction independently.
+	// Held body destroyed: clear the replicated state so every machine drops the
+	// grab together, rather than each deciding on its own.
 	if (!GrabbedComponent.IsValid())
 	{
-		if (GrabConstraint)
-		{
-			GrabConstraint->DestroyComponent();
-			GrabConstraint = nullptr;
-		}
-		bIsGrabbing = false;
-		RestoreNormalMovementSettings();
+		SetGrabState(nullptr, INDEX_NONE);
 		return;
 	}
 
-	// Server-authoritative auto-release: if the object drifted too far, the server
-	// multicasts the release to all machines.
-	if (HasAuthority())
+	// Async physics: the fixed-step callback measures the drift against the body's
+	// physics-thread position. Its verdict arrives a frame later, tagged with the grab
+	// it was measured for.
+	if (UCatAsyncPhysicsSubsystem* AsyncPhysics = UCatAsyncPhysicsSubsystem::GetActive(this))
 	{
-		const float Dist = FVector::Dist(
-			GrabTargetLocation->GetComponentLocation(),
-			GrabbedComponent->GetComponentLocation());
-
-		if (Dist > MaxGrabDistance)
+		if (UCatAsyncPhysicsSubsystem::GetSingleParticleProxy(GrabbedComponent.Get()))
 		{
-			Multicast_ReleaseGrab();
+			const FCatAsyncCatOutput* Output = AsyncPhysics->FindCatOutput(this);
+			if (Output && Output->bGrabOverreached && Output->GrabSequence == GrabState.Sequence)
+			{
+				SetGrabState(nullptr, INDEX_NONE);
+				return;
+			}
+
+			FCatAsyncCatInput& Input = AsyncPhysics->EditCatInput(this);
+			Input.HeldBody        = GrabbedComponent.Get();
+			Input.GrabTarget      = GrabTargetLocation->GetComponentLocation();
+			Input.MaxGrabDistance = MaxGrabDistance;
+			Input.GrabSequence    = GrabState.Sequence;
 			return;
 		}
 	}
+
+	// Server-authoritative auto-release: the object drifted too far.
+	const float Dist = FVector::Dist(
+		GrabTargetLocation->GetComponentLocation(),
+		GrabbedComponent->GetComponentLocation());
+
+	if (Dist > MaxGrabDistance)
+	{
+		SetGrabState(nullptr, INDEX_NONE);
+	}
+}
+
+void ACatBase::ConfigureGrabConstraint()
+{
+	// Linear: limited slack + position/velocity drive toward anchor.
+	GrabConstraint->SetLinearXLimit(ELinearConstraintMotion::LCM_Limited, GrabLinearLimit);
+	GrabConstraint->SetLinearYLimit(ELinearConstraintMotion::LCM_Limited, GrabLinearLimit);
+	GrabConstraint->SetLinearZLimit(ELinearConstraintMotion::LCM_Limited, GrabLinearLimit);
+	GrabConstraint->SetLinearPositionDrive(true, true, true);
+	GrabConstraint->SetLinearVelocityDrive(true, true, true);
+	GrabConstraint->SetLinearDriveParams(GrabConstraintStiffness, GrabConstraintDamping, GrabConstraintMaxForce);
+
+	// Angular: free — let the object tumble naturally while being dragged.
+	GrabConstraint->SetAngularSwing1Limit(EAngularConstraintMotion::ACM_Free, 0.0f);
+	GrabConstraint->SetAngularSwing2Limit(EAngularConstraintMotion::ACM_Free, 0.0f);
+	GrabConstraint->SetAngularTwistLimit(EAngularConstraintMotion::ACM_Free, 0.0f);
+
+	// Disable collision between constrained bodies to prevent jitter.
+	GrabConstraint->SetDisableCollision(true);
+}
+
+void ACatBase::UnbindGrabConstraint()
+{
+	SCOPE_CYCLE_COUNTER(STAT_CatGrabUnbind);
+
+	// Terminates the solver joint only; the settings above survive for the next bind.
+	GrabConstraint->BreakConstraint();
+	GrabConstraint->SetConstrainedComponents(nullptr, NAME_None, nullptr, NAME_None);
 }
 
 void ACatBase::ApplyDragMovementSettings()
@@ -791,12 +1539,192 @@ void ACatBase::RestoreNormalMovementSettings()
 	}
 }
 
-void ACatBase::OnRep_bIsGrabbing()
+// ══════════════════════════════════════════════════════════════════════════
+// ── Ragdoll ─────────────────────────────────────────────────────────────
+// ══════════════════════════════════════════════════════════════════════════
+
+void ACatBase::Knockout(float Duration)
 {
-	if (bIsGrabbing)
-		ApplyDragMovementSettings();
+	if (!HasAuthority() || bDied) return;
+
+	if (!bIsRagdoll)
+	{
+		bIsRagdoll = true;
+		EnterRagdollLocal();
+	}
+
+	// Re-knocking an already ragdolled cat just extends the timer.
+	GetWorldTimerManager().SetTimer(RagdollRecoverTimerHandle, this,
+		&ACatBase::RecoverFromKnockout, FMath::Max(Duration, 0.1f), false);
+}
+
+void ACatBase::Die()
+{
+	if (!HasAuthority() || bDied) return;
+
+	bDied      = true;
+	BaseAction = ECatBaseAction::Dead;
+	GetWorldTimerManager().ClearTimer(RagdollRecoverTimerHandle);
+
+	if (!bIsRagdoll)
+	{
+		bIsRagdoll = true;
+		EnterRagdollLocal();
+	}
+}
+
+void ACatBase::RecoverFromKnockout()
+{
+	if (bDied || !bIsRagdoll) return;
+
+	bIsRagdoll = false;
+	ExitRagdollLocal();
+}
+
+void ACatBase::EnterRagdollLocal()
+{
+	USkeletalMeshComponent* MeshComp = GetMesh();
+	if (!MeshComp || MeshComp->IsSimulatingPhysics(RagdollPelvisBone)) return;
+
+	// A ragdolled jaw can't hold anything — the server drops the grab for everyone.
+	if (HasAuthority() && GrabState.Target)
+	{
+		SetGrabState(nullptr, INDEX_NONE);
+	}
+
+	StopAnimMontage();
+	bIsSwatting = false;
+
+	// Carry the capsule's momentum into the bodies so a knockout at a sprint tumbles forward.
+	const FVector InheritedVelocity = GetVelocity();
+
+	if (UCharacterMovementComponent* CMC = GetCharacterMovement())
+	{
+		CMC->StopMovementImmediately();
+		CMC->DisableMovement();
+	}
+	GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+
+	MeshComp->SetCollisionProfileName(RagdollCollisionProfile);
+	MeshComp->SetSimulatePhysics(true);
+	MeshComp->SetAllPhysicsLinearVelocity(InheritedVelocity);
+	MeshComp->WakeAllRigidBodies();
+
+	MovementStage = ECatMovementStage::Ragdoll;
+
+	// Server: replicate the root body only, at a reduced fixed rate.
+	if (HasAuthority())
+	{
+		SampleRagdollRootState();
+		GetWorldTimerManager().SetTimer(RagdollSampleTimerHandle, this,
+			&ACatBase::SampleRagdollRootState, 1.0f / FMath::Max(RagdollNetUpdateRate, 1.0f), true);
+	}
+}
+
+void ACatBase::ExitRagdollLocal()
+{
+	USkeletalMeshComponent* MeshComp = GetMesh();
+	if (!MeshComp || !MeshComp->IsSimulatingPhysics(RagdollPelvisBone)) return;
+
+	GetWorldTimerManager().ClearTimer(RagdollSampleTimerHandle);
+	RagdollStateReceiveTime = 0.0;
+
+	const FVector PelvisLocation = MeshComp->GetSocketLocation(RagdollPelvisBone);
+
+	MeshComp->SetSimulatePhysics(false);
+	MeshComp->SetCollisionProfileName(MeshCollisionProfileCache);
+
+	// Stand the capsule up where the body came to rest. The server's placement replicates;
+	// clients place locally too so there's no one-frame pop before the correction arrives.
+	const float HalfHeight = GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+	SetActorLocation(PelvisLocation + FVector(0.0f, 0.0f, HalfHeight), false, nullptr, ETeleportType::TeleportPhysics);
+
+	// Physics may have detached the mesh when simulation began — snap it back onto the capsule.
+	MeshComp->AttachToComponent(GetCapsuleComponent(), FAttachmentTransformRules::KeepRelativeTransform);
+	MeshComp->SetRelativeTransform(MeshRelativeTransformCache);
+
+	GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+	ForceWalkingMovementMode();
+}
+
+void ACatBase::SampleRagdollRootState()
+{
+	const USkeletalMeshComponent* MeshComp = GetMesh();
+	if (!MeshComp || !bIsRagdoll) return;
+
+	const FTransform Pelvis  = MeshComp->GetSocketTransform(RagdollPelvisBone);
+	const FVector   Velocity = MeshComp->GetPhysicsLinearVelocity(RagdollPelvisBone);
+
+	// A settled body keeps writing sub-millimetre noise — don't let that dirty the property.
+	constexpr float MinMoveSq = 1.0f;
+	constexpr float MinSpeedSq = 25.0f;
+	if (FVector::DistSquared(Pelvis.GetLocation(), RagdollRootState.PelvisLocation) < MinMoveSq
+		&& Velocity.SizeSquared() < MinSpeedSq
+		&& RagdollRootState.PelvisVelocity.SizeSquared() < MinSpeedSq)
+	{
+		return;
+	}
+
+	RagdollRootState.PelvisLocation = Pelvis.GetLocation();
+	RagdollRootState.PelvisRotation = Pelvis.Rotator();
+	RagdollRootState.PelvisVelocity = Velocity;
+}
+
+void ACatBase::UpdateRagdoll(float DeltaTime)
+{
+	USkeletalMeshComponent* MeshComp = GetMesh();
+	if (!MeshComp || !MeshComp->IsSimulatingPhysics(RagdollPelvisBone)) return;
+
+	const FTransform PelvisWorld = MeshComp->GetSocketTransform(RagdollPelvisBone);
+
+	// Capsule rides above the pelvis (collision is off) so the camera boom and
+	// net relevancy follow the body on every machine.
+	const float HalfHeight = GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+	SetActorLocation(PelvisWorld.GetLocation() + FVector(0.0f, 0.0f, HalfHeight));
+
+	// Clients: the rest of the skeleton is reconstructed by local simulation; only the
+	// pelvis is pulled toward the server's extrapolated root.
+	if (HasAuthority() || RagdollStateReceiveTime <= 0.0) return;
+
+	constexpr double MaxExtrapolationSeconds = 0.5;
+	const double Age = FMath::Min(GetWorld()->GetTimeSeconds() - RagdollStateReceiveTime, MaxExtrapolationSeconds);
+	const FVector TargetLocation = RagdollRootState.PelvisLocation + RagdollRootState.PelvisVelocity * Age;
+	const FVector Error = TargetLocation - PelvisWorld.GetLocation();
+
+	if (Error.SizeSquared() > FMath::Square(RagdollSnapDistance))
+	{
+		// Too far to steer — rigidly re-place every body so the pelvis lands on the target pose.
+		const FTransform TargetPelvis(RagdollRootState.PelvisRotation, TargetLocation);
+		const FTransform Delta = PelvisWorld.Inverse() * TargetPelvis;
+
+		for (FBodyInstance* Body : MeshComp->Bodies)
+		{
+			if (!Body || !Body->IsValidBodyInstance()) continue;
+			Body->SetBodyTransform(Body->GetUnrealWorldTransform() * Delta, ETeleportType::TeleportPhysics);
+		}
+		MeshComp->SetAllPhysicsLinearVelocity(RagdollRootState.PelvisVelocity);
+		return;
+	}
+
+	MeshComp->SetPhysicsLinearVelocity(
+		FVector(RagdollRootState.PelvisVelocity) + Error * RagdollCorrectionGain, false, RagdollPelvisBone);
+}
+
+void ACatBase::OnRep_bIsRagdoll()
+{
+	if (bIsRagdoll)
+	{
+		EnterRagdollLocal();
+	}
 	else
-		RestoreNormalMovementSettings();
+	{
+		ExitRagdollLocal();
+	}
+}
+
+void ACatBase::OnRep_RagdollRootState()
+{
+	RagdollStateReceiveTime = GetWorld()->GetTimeSeconds();
 }
 
 // ══════════════════════════════════════════════════════════════════════════
@@ -820,7 +1748,10 @@ void ACatBase::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetime
 	DOREPLIFETIME(ACatBase, JumpPhase);
 	DOREPLIFETIME_CONDITION(ACatBase, bGoTurn, COND_SkipOwner);
 	DOREPLIFETIME_CONDITION(ACatBase, TurnRateAnim, COND_SkipOwner);
-	DOREPLIFETIME(ACatBase, bIsGrabbing);
+	DOREPLIFETIME(ACatBase, GrabState);
+	DOREPLIFETIME_CONDITION(ACatBase, HeldBodyState, COND_SkipOwner);
+	DOREPLIFETIME(ACatBase, bIsRagdoll);
+	DOREPLIFETIME(ACatBase, RagdollRootState);
 }
 
 void ACatBase::PossessedBy(AController* NewController)
@@ -899,7 +1830,11 @@ void ACatBase::UpdateAnimationStates()
 	bIsFalling = CMC->IsFalling();
 
 	// (e) MovementStage
-	if (CMC->MovementMode == MOVE_Swimming)
+	if (bIsRagdoll)
+	{
+		MovementStage = ECatMovementStage::Ragdoll;
+	}
+	else if (CMC->MovementMode == MOVE_Swimming)
 	{
 		MovementStage = ECatMovementStage::Swimming;
 	}
@@ -1144,6 +2079,7 @@ void ACatBase::Landed(const FHitResult& Hit)
 
 bool ACatBase::CanJumpInternal_Implementation() const
 {
+	if (bIsRagdoll) return false;
 	if (JumpCooldownTimer > 0.0f) return false;
 	return Super::CanJumpInternal_Implementation();
 }
@@ -1157,6 +2093,9 @@ void ACatBase::UpdateJumpGravity()
 	// Simulated proxies receive replicated position/velocity.
 	if (!HasAuthority() && !IsLocallyControlled()) return;
 
+	// Ragdolled — movement is disabled and the physics asset owns the body.
+	if (bIsRagdoll) return;
+
 	// On ground phases — snap the interpolator back to Rising so the next
 	// airborne jump starts from the correct baseline, not a stale fall value.
 	if (JumpPhase == ECatJumpPhase::None || JumpPhase == ECatJumpPhase::Land)
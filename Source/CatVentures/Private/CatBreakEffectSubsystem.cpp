@@ -0,0 +1,276 @@
+// CatBreakEffectSubsystem.cpp
+
+#include "CatBreakEffectSubsystem.h"
+#include "CatGameMode.h"
+#include "CatVentures.h"
+#include "Components/AudioComponent.h"
+#include "Engine/AssetManager.h"
+#include "Engine/DataTable.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+#include "GameFramework/GameStateBase.h"
+#include "NiagaraComponent.h"
+#include "NiagaraSystem.h"
+#include "Sound/SoundBase.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Break Effects Requested"), STAT_CatBreakFxRequested, STATGROUP_CatVentures);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Break Effects Played"),    STAT_CatBreakFxPlayed,    STATGROUP_CatVentures);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Break Effects Merged"),    STAT_CatBreakFxMerged,    STATGROUP_CatVentures);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Break Effects Dropped"),   STAT_CatBreakFxDropped,   STATGROUP_CatVentures);
+DECLARE_CYCLE_STAT(TEXT("Break Effect Dispatch"), STAT_CatBreakFxDispatch, STATGROUP_CatVentures);
+
+UCatBreakEffectSubsystem* UCatBreakEffectSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UCatBreakEffectSubsystem>() : nullptr;
+}
+
+bool UCatBreakEffectSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return !IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+}
+
+bool UCatBreakEffectSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UCatBreakEffectSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCatBreakEffectSubsystem, STATGROUP_Tickables);
+}
+
+void UCatBreakEffectSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	LoadAssets();
+}
+
+void UCatBreakEffectSubsystem::Deinitialize()
+{
+	if (AssetHandle.IsValid())
+	{
+		AssetHandle->CancelHandle();
+		AssetHandle.Reset();
+	}
+
+	for (UNiagaraComponent* Comp : EffectPool)
+	{
+		if (Comp) Comp->DestroyComponent();
+	}
+	for (UAudioComponent* Comp : AudioPool)
+	{
+		if (Comp) Comp->DestroyComponent();
+	}
+	EffectPool.Reset();
+	AudioPool.Reset();
+
+	Super::Deinitialize();
+}
+
+// ── Setup ───────────────────────────────────────────────────────────
+
+void UCatBreakEffectSubsystem::LoadAssets()
+{
+	TArray<FSoftObjectPath> Paths;
+	if (!BreakEffect.IsNull()) Paths.Add(BreakEffect.ToSoftObjectPath());
+	if (!BreakSound.IsNull())  Paths.Add(BreakSound.ToSoftObjectPath());
+
+	// Unset defaults leave every non-stinger break silent and invisible — say so once.
+	if (BreakEffect.IsNull() || BreakSound.IsNull())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UCatBreakEffectSubsystem — BreakEffect/BreakSound not set in DefaultGame.ini; ")
+			TEXT("breaks without a MeowStinger play no effect."));
+	}
+
+	// Every stinger a prop could ask for, read off the GameMode class default so clients
+	// see the same table as the server.
+	const AGameStateBase* GS = GetWorld()->GetGameState();
+	const ACatGameMode* GMDefault = GS ? GS->GetDefaultGameMode<ACatGameMode>() : nullptr;
+	if (GMDefault && GMDefault->ChaosRewardTable)
+	{
+		GMDefault->ChaosRewardTable->ForeachRow<FChaosRewardData>(TEXT("UCatBreakEffectSubsystem"),
+			[&Paths](const FName&, const FChaosRewardData& Row)
+			{
+				if (!Row.MeowStinger.IsNull()) Paths.AddUnique(Row.MeowStinger.ToSoftObjectPath());
+			});
+	}
+
+	if (Paths.IsEmpty())
+	{
+		CreatePools();
+		return;
+	}
+
+	AssetHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(Paths),
+		FStreamableDelegate::CreateUObject(this, &UCatBreakEffectSubsystem::CreatePools));
+}
+
+void UCatBreakEffectSubsystem::CreatePools()
+{
+	UWorld* World = GetWorld();
+	if (!World || bPoolsReady) return;
+
+	// Outer the pool on the world settings, as the engine's fire-and-forget spawners do,
+	// so the components live exactly as long as the level.
+	UObject* Outer = World->GetWorldSettings() ? static_cast<UObject*>(World->GetWorldSettings()) : World;
+
+	if (UNiagaraSystem* System = BreakEffect.Get())
+	{
+		for (int32 i = 0; i < EffectPoolSize; ++i)
+		{
+			UNiagaraComponent* Comp = NewObject<UNiagaraComponent>(Outer);
+			Comp->SetAutoActivate(false);
+			Comp->SetAsset(System);
+			Comp->RegisterComponentWithWorld(World);
+			EffectPool.Add(Comp);
+		}
+	}
+	EffectStartTimes.Init(-UE_BIG_NUMBER, EffectPool.Num());
+
+	for (int32 i = 0; i < AudioPoolSize; ++i)
+	{
+		UAudioComponent* Comp = NewObject<UAudioComponent>(Outer);
+		Comp->bAutoActivate = false;
+		Comp->bAutoDestroy = false;
+		Comp->bAllowSpatialization = true;
+		Comp->RegisterComponentWithWorld(World);
+		AudioPool.Add(Comp);
+	}
+	AudioStartTimes.Init(-UE_BIG_NUMBER, AudioPool.Num());
+
+	bPoolsReady = true;
+}
+
+// ── Requests ────────────────────────────────────────────────────────
+
+void UCatBreakEffectSubsystem::RequestBreakEffect(const FVector& Location, float Magnitude,
+	const TSoftObjectPtr<USoundBase>& Stinger)
+{
+	INC_DWORD_STAT(STAT_CatBreakFxRequested);
+
+	const float MergeRadiusSq = FMath::Square(MergeRadius);
+	for (FPendingEffect& Effect : Pending)
+	{
+		if (FVector::DistSquared(Effect.Location, Location) > MergeRadiusSq) continue;
+
+		// Centre drifts toward the cluster of breaks; the strongest sets the magnitude.
+		++Effect.Count;
+		Effect.Location += (Location - Effect.Location) / Effect.Count;
+		Effect.Magnitude = FMath::Max(Effect.Magnitude, Magnitude);
+		if (Effect.Stinger.IsNull()) Effect.Stinger = Stinger;
+
+		INC_DWORD_STAT(STAT_CatBreakFxMerged);
+		return;
+	}
+
+	FPendingEffect& Effect = Pending.AddDefaulted_GetRef();
+	Effect.Location  = Location;
+	Effect.Magnitude = Magnitude;
+	Effect.Count     = 1;
+	Effect.Stinger   = Stinger;
+}
+
+void UCatBreakEffectSubsystem::Tick(float DeltaTime)
+{
+	if (Pending.IsEmpty() && Playing.IsEmpty()) return;
+
+	SCOPE_CYCLE_COUNTER(STAT_CatBreakFxDispatch);
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	Playing.RemoveAllSwap([Now, this](const FPlayingEffect& Effect)
+	{
+		return Now - Effect.StartTime > EffectLifetime;
+	});
+
+	if (Pending.IsEmpty() || !bPoolsReady)
+	{
+		INC_DWORD_STAT_BY(STAT_CatBreakFxDropped, Pending.Num());
+		Pending.Reset();
+		return;
+	}
+
+	Pending.Sort([](const FPendingEffect& A, const FPendingEffect& B)
+	{
+		return A.Magnitude * A.Count > B.Magnitude * B.Count;
+	});
+
+	const float AreaRadiusSq = FMath::Square(AreaRadius);
+	int32 Started = 0;
+
+	for (const FPendingEffect& Effect : Pending)
+	{
+		if (Started >= MaxEffectsPerFrame)
+		{
+			INC_DWORD_STAT(STAT_CatBreakFxDropped);
+			continue;
+		}
+
+		int32 Nearby = 0;
+		for (const FPlayingEffect& Other : Playing)
+		{
+			if (FVector::DistSquared(Other.Location, Effect.Location) <= AreaRadiusSq) ++Nearby;
+		}
+		if (Nearby >= MaxEffectsPerArea)
+		{
+			INC_DWORD_STAT(STAT_CatBreakFxDropped);
+			continue;
+		}
+
+		Dispatch(Effect, Now);
+		Playing.Add(FPlayingEffect{ Effect.Location, Now });
+		++Started;
+	}
+
+	INC_DWORD_STAT_BY(STAT_CatBreakFxPlayed, Started);
+	Pending.Reset();
+}
+
+void UCatBreakEffectSubsystem::Dispatch(const FPendingEffect& Effect, double Now)
+{
+	const int32 EffectSlot = AcquireSlot(EffectStartTimes, Now, EffectLifetime);
+	if (EffectSlot != INDEX_NONE)
+	{
+		UNiagaraComponent* Comp = EffectPool[EffectSlot];
+		Comp->SetWorldLocation(Effect.Location);
+		Comp->SetVariableFloat(TEXT("BreakMagnitude"), Effect.Magnitude);
+		Comp->SetVariableInt(TEXT("BreakCount"), Effect.Count);
+		Comp->Activate(/*bReset=*/true);
+	}
+
+	USoundBase* Sound = Effect.Stinger.Get();
+	if (!Sound) Sound = BreakSound.Get();
+	if (!Sound) return;
+
+	const int32 AudioSlot = AcquireSlot(AudioStartTimes, Now, EffectLifetime);
+	if (AudioSlot != INDEX_NONE)
+	{
+		UAudioComponent* Comp = AudioPool[AudioSlot];
+		Comp->SetSound(Sound);
+		Comp->SetWorldLocation(Effect.Location);
+		Comp->SetVolumeMultiplier(FMath::Min(1.0f + 0.1f * (Effect.Count - 1), 1.5f));
+		Comp->Play();
+	}
+}
+
+int32 UCatBreakEffectSubsystem::AcquireSlot(TArray<double>& StartTimes, double Now, float Lifetime)
+{
+	int32 Oldest = INDEX_NONE;
+	for (int32 i = 0; i < StartTimes.Num(); ++i)
+	{
+		if (Now - StartTimes[i] > Lifetime)
+		{
+			Oldest = i;
+			break;
+		}
+		if (Oldest == INDEX_NONE || StartTimes[i] < StartTimes[Oldest]) Oldest = i;
+	}
+
+	if (Oldest != INDEX_NONE)
+	{
+		StartTimes[Oldest] = Now;
+	}
+	return Oldest;
+}
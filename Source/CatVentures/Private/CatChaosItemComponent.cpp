@@ -0,0 +1,84 @@
+// CatChaosItemComponent.cpp
+
+#include "CatChaosItemComponent.h"
+#include "CatBreakEffectSubsystem.h"
+#include "CatDestructibleSubsystem.h"
+#include "CatGameMode.h"
+#include "CatGameState.h"
+#include "Engine/DataTable.h"
+#include "Engine/World.h"
+#include "GameFramework/GameStateBase.h"
+
+UCatChaosItemComponent::UCatChaosItemComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UCatChaosItemComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	CacheRewardData();
+
+	AActor* Owner = GetOwner();
+	if (Owner && Owner->HasAuthority())
+	{
+		Owner->OnTakePointDamage.AddDynamic(this, &UCatChaosItemComponent::HandlePointDamage);
+	}
+}
+
+void UCatChaosItemComponent::CacheRewardData()
+{
+	if (ChaosRewardKey.IsNone()) return;
+
+	// The GameMode only exists on the server — read the table off its class default so
+	// clients resolve the same row for cosmetics.
+	const UWorld* World = GetWorld();
+	const AGameStateBase* GS = World ? World->GetGameState() : nullptr;
+	const ACatGameMode* GMDefault = GS ? GS->GetDefaultGameMode<ACatGameMode>() : nullptr;
+	if (!GMDefault || !GMDefault->ChaosRewardTable) return;
+
+	if (const FChaosRewardData* Row = GMDefault->ChaosRewardTable->FindRow<FChaosRewardData>(
+			ChaosRewardKey, TEXT("UCatChaosItemComponent")))
+	{
+		RewardData = *Row;
+		bHasRewardData = true;
+	}
+}
+
+void UCatChaosItemComponent::HandlePointDamage(AActor* DamagedActor, float Damage, AController* InstigatedBy,
+	FVector HitLocation, UPrimitiveComponent* HitComponent, FName BoneName, FVector ShotFromDirection,
+	const UDamageType* DamageType, AActor* DamageCauser)
+{
+	if (Damage <= 0.0f) return;
+
+	OnChaosItemDamaged(Damage, HitLocation);
+
+	// Same path as a bumper hit: the fracture log applies it on every peer.
+	const UCatDestructibleSubsystem* Registry = UCatDestructibleSubsystem::Get(this);
+	const uint32 DestructibleId = Registry ? Registry->GetId(DamagedActor) : UCatDestructibleSubsystem::InvalidId;
+	if (DestructibleId == UCatDestructibleSubsystem::InvalidId || Registry->IsShattered(DestructibleId)) return;
+
+	if (ACatGameState* GS = GetWorld()->GetGameState<ACatGameState>())
+	{
+		GS->QueueFractureEvent(DestructibleId, HitLocation, DamageFractureTuning, Damage * StrainPerDamage);
+	}
+}
+
+void UCatChaosItemComponent::NotifyFractured(const FVector& Origin, bool bPlayEffects)
+{
+	const bool bFirstBreak = !bHasFractured;
+	bHasFractured = true;
+
+	// Catch-up replays only need the state above — no VFX, audio or cosmetic hook.
+	if (!bPlayEffects) return;
+
+	// Default VFX / audio go through the pooled dispatcher; the stinger only on the first break.
+	if (UCatBreakEffectSubsystem* Effects = UCatBreakEffectSubsystem::Get(this))
+	{
+		Effects->RequestBreakEffect(Origin, bFirstBreak ? 1.0f : 0.5f,
+			bFirstBreak && bHasRewardData ? RewardData.MeowStinger : TSoftObjectPtr<USoundBase>());
+	}
+
+	OnChaosItemFractured(Origin, bFirstBreak);
+}
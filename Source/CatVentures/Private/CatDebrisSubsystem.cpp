@@ -0,0 +1,317 @@
+// CatDebrisSubsystem.cpp
+
+#include "CatDebrisSubsystem.h"
+#include "CatGameState.h"
+#include "CatVentures.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "GeometryCollection/GeometryCollectionComponent.h"
+#include "GeometryCollection/Facades/CollectionDynamicStateFacade.h"
+#include "PhysicsProxy/GeometryCollectionPhysicsProxy.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Debris Active"),  STAT_CatDebrisActive,  STATGROUP_CatVentures);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Debris Demoted"), STAT_CatDebrisDemoted, STATGROUP_CatVentures);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Debris Frozen"),  STAT_CatDebrisFrozen,  STATGROUP_CatVentures);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Debris Removed"), STAT_CatDebrisRemoved, STATGROUP_CatVentures);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Debris Live"),    STAT_CatDebrisLive,    STATGROUP_CatVentures);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Debris Budget"),  STAT_CatDebrisBudget,  STATGROUP_CatVentures);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Debris Retired By Budget"), STAT_CatDebrisRetired, STATGROUP_CatVentures);
+DECLARE_CYCLE_STAT(TEXT("Debris Lifecycle"), STAT_CatDebrisTick, STATGROUP_CatVentures);
+DECLARE_CYCLE_STAT(TEXT("Debris Budget Ranking"), STAT_CatDebrisBudgetRank, STATGROUP_CatVentures);
+
+// ── Console ─────────────────────────────────────────────────────────────
+
+static TAutoConsoleVariable<int32> CVarCatDebrisBudget(
+	TEXT("cat.Debris.Budget"),
+	-1,
+	TEXT("Max live fracture fragments across all geometry collections. ")
+	TEXT("-1 = UCatDebrisSubsystem::DefaultParticleBudget from DefaultGame.ini, 0 = unlimited."),
+	ECVF_Scalability);
+
+UCatDebrisSubsystem* UCatDebrisSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UCatDebrisSubsystem>() : nullptr;
+}
+
+bool UCatDebrisSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UCatDebrisSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCatDebrisSubsystem, STATGROUP_Tickables);
+}
+
+void UCatDebrisSubsystem::TrackCollection(UGeometryCollectionComponent* GCC)
+{
+	if (!GCC) return;
+	FindOrAddCollection(GCC);
+}
+
+void UCatDebrisSubsystem::SetCollectionValue(UGeometryCollectionComponent* GCC, float Value)
+{
+	if (!GCC) return;
+	FindOrAddCollection(GCC).Value = Value;
+}
+
+void UCatDebrisSubsystem::Reset()
+{
+	Collections.Reset();
+	LiveFragmentCount = 0;
+	TimeSinceUpdate = 0.0f;
+}
+
+UCatDebrisSubsystem::FDebrisCollection& UCatDebrisSubsystem::FindOrAddCollection(UGeometryCollectionComponent* GCC)
+{
+	for (FDebrisCollection& Collection : Collections)
+	{
+		if (Collection.GCC.Get() == GCC) return Collection;
+	}
+
+	FDebrisCollection& Collection = Collections.AddDefaulted_GetRef();
+	Collection.GCC = GCC;
+	return Collection;
+}
+
+void UCatDebrisSubsystem::Tick(float DeltaTime)
+{
+	TimeSinceUpdate += DeltaTime;
+	if (TimeSinceUpdate < UpdateInterval) return;
+
+	SCOPE_CYCLE_COUNTER(STAT_CatDebrisTick);
+
+	const float Elapsed = TimeSinceUpdate;
+	TimeSinceUpdate = 0.0f;
+
+	Collections.RemoveAllSwap([](const FDebrisCollection& Collection)
+	{
+		return !Collection.GCC.IsValid() || !Collection.bHasLiveFragments;
+	});
+
+	int32 StageCounts[4] = {};
+	for (FDebrisCollection& Collection : Collections)
+	{
+		UGeometryCollectionComponent* GCC = Collection.GCC.Get();
+		Collection.bProtected = !CanRemoveDebrisOf(GCC->GetOwner());
+		const bool bAllowRemoval = !Collection.bProtected && !GCC->WasRecentlyRendered(OffscreenRemoveDelay);
+
+		UpdateCollection(Collection, Elapsed, bAllowRemoval, StageCounts);
+	}
+
+	LiveFragmentCount = StageCounts[static_cast<int32>(ECatDebrisStage::Active)]
+		+ StageCounts[static_cast<int32>(ECatDebrisStage::Demoted)]
+		+ StageCounts[static_cast<int32>(ECatDebrisStage::Frozen)];
+
+	const int32 BudgetOverride = CVarCatDebrisBudget.GetValueOnGameThread();
+	const int32 Budget = BudgetOverride >= 0 ? BudgetOverride : DefaultParticleBudget;
+
+	if (Budget > 0 && LiveFragmentCount > Budget)
+	{
+		const int32 Retired = EnforceBudget(Budget);
+		LiveFragmentCount -= Retired;
+		StageCounts[static_cast<int32>(ECatDebrisStage::Removed)] += Retired;
+		INC_DWORD_STAT_BY(STAT_CatDebrisRetired, Retired);
+	}
+
+	SET_DWORD_STAT(STAT_CatDebrisLive, LiveFragmentCount);
+	SET_DWORD_STAT(STAT_CatDebrisBudget, Budget);
+
+	SET_DWORD_STAT(STAT_CatDebrisActive,  StageCounts[static_cast<int32>(ECatDebrisStage::Active)]);
+	SET_DWORD_STAT(STAT_CatDebrisDemoted, StageCounts[static_cast<int32>(ECatDebrisStage::Demoted)]);
+	SET_DWORD_STAT(STAT_CatDebrisFrozen,  StageCounts[static_cast<int32>(ECatDebrisStage::Frozen)]);
+	SET_DWORD_STAT(STAT_CatDebrisRemoved, StageCounts[static_cast<int32>(ECatDebrisStage::Removed)]);
+}
+
+void UCatDebrisSubsystem::UpdateCollection(FDebrisCollection& Collection, float Elapsed, bool bAllowRemoval,
+	int32 (&OutStageCounts)[4])
+{
+	UGeometryCollectionComponent* GCC = Collection.GCC.Get();
+	FGeometryDynamicCollection* DynCollection = GCC->GetDynamicCollection();
+	if (!DynCollection) return;
+
+	FGeometryCollectionDynamicStateFacade StateFacade(*DynCollection);
+	const TArray<FTransform3f>& Transforms = GCC->GetComponentSpaceTransforms3f();
+	Collection.Fragments.SetNum(Transforms.Num());
+
+	const float SettleToleranceSq = FMath::Square(SettleTolerance);
+
+	// Batched per stage so each GC API call happens at most once per pass.
+	TArray<int32> ToDemote;
+	TArray<int32> ToFreeze;
+	TArray<int32> ToRemove;
+
+	bool bHasDebris = false;
+	bool bHasLiveFragments = false;
+
+	for (int32 i = 0; i < Transforms.Num(); ++i)
+	{
+		// Only separated leaves are debris — clusters and still-attached pieces are the prop.
+		if (StateFacade.HasChildren(i) || !StateFacade.HasBrokenOff(i)) continue;
+
+		FDebrisFragment& Fragment = Collection.Fragments[i];
+		const FVector3f Location = Transforms[i].GetLocation();
+
+		if (Fragment.bSampled && FVector3f::DistSquared(Location, Fragment.LastLocation) <= SettleToleranceSq)
+		{
+			Fragment.RestTime += Elapsed;
+		}
+		else
+		{
+			Fragment.RestTime = 0.0f;
+		}
+		Fragment.LastLocation = Location;
+		Fragment.bSampled = true;
+		Fragment.Age += Elapsed;
+
+		switch (Fragment.Stage)
+		{
+		case ECatDebrisStage::Active:
+			if (Fragment.RestTime >= SettleTime)
+			{
+				Fragment.Stage = ECatDebrisStage::Demoted;
+				ToDemote.Add(i);
+			}
+			break;
+
+		case ECatDebrisStage::Demoted:
+			if (Fragment.RestTime >= SettleTime + FreezeDelay)
+			{
+				Fragment.Stage = ECatDebrisStage::Frozen;
+				ToFreeze.Add(i);
+			}
+			break;
+
+		case ECatDebrisStage::Frozen:
+			if (bAllowRemoval)
+			{
+				Fragment.Stage = ECatDebrisStage::Removed;
+				ToRemove.Add(i);
+			}
+			break;
+
+		default:
+			break;
+		}
+
+		bHasDebris = true;
+		bHasLiveFragments |= Fragment.Stage != ECatDebrisStage::Removed;
+		++OutStageCounts[static_cast<int32>(Fragment.Stage)];
+	}
+
+	// A GC with no broken-off leaves yet (graded hit that broke nothing) stays tracked.
+	Collection.bHasLiveFragments = bHasLiveFragments || !bHasDebris;
+
+	if (ToDemote.Num() > 0)
+	{
+		GCC->SetPerParticleCollisionProfileName(ToDemote, DebrisCollisionProfile);
+	}
+
+	for (const int32 Index : ToFreeze)
+	{
+		GCC->SetAnchoredByIndex(Index, true);
+	}
+
+	if (ToRemove.Num() > 0)
+	{
+		if (FGeometryCollectionPhysicsProxy* Proxy = GCC->GetPhysicsProxy())
+		{
+			Proxy->DisableParticles_External(MoveTemp(ToRemove));
+		}
+	}
+}
+
+bool UCatDebrisSubsystem::CanRemoveDebrisOf(const AActor* GCActor) const
+{
+	const ACatGameState* GS = GetWorld()->GetGameState<ACatGameState>();
+	if (!GS) return true;
+
+	// The match-end cameras frame the wreckage — nothing disappears once the sequence starts.
+	if (GS->MatchPhase != ECatMatchPhase::Playing) return false;
+
+	return !GS->TopValueSites.Contains(GCActor);
+}
+
+int32 UCatDebrisSubsystem::EnforceBudget(int32 Budget)
+{
+	SCOPE_CYCLE_COUNTER(STAT_CatDebrisBudgetRank);
+
+	// Nearest-player distance is measured from every pawn this machine knows about —
+	// all cats on the server, the local cat on a client.
+	TArray<FVector, TInlineAllocator<4>> PlayerLocations;
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		if (const APawn* Pawn = It->Get() ? It->Get()->GetPawn() : nullptr)
+		{
+			PlayerLocations.Add(Pawn->GetActorLocation());
+		}
+	}
+
+	struct FCandidate
+	{
+		int32 CollectionIndex;
+		int32 FragmentIndex;
+		float Score;
+	};
+
+	TArray<FCandidate> Candidates;
+	Candidates.Reserve(LiveFragmentCount);
+
+	for (int32 c = 0; c < Collections.Num(); ++c)
+	{
+		const FDebrisCollection& Collection = Collections[c];
+		if (Collection.bProtected) continue;
+
+		const FTransform CompToWorld = Collection.GCC->GetComponentTransform();
+		const float ValueTerm = ValueWeight * Collection.Value / ValueScale;
+
+		for (int32 i = 0; i < Collection.Fragments.Num(); ++i)
+		{
+			const FDebrisFragment& Fragment = Collection.Fragments[i];
+			if (!Fragment.bSampled || Fragment.Stage == ECatDebrisStage::Removed) continue;
+
+			const FVector WorldLocation = CompToWorld.TransformPosition(FVector(Fragment.LastLocation));
+			float NearestDistSq = PlayerLocations.Num() > 0 ? UE_MAX_FLT : 0.0f;
+			for (const FVector& PlayerLocation : PlayerLocations)
+			{
+				NearestDistSq = FMath::Min(NearestDistSq, FVector::DistSquared(WorldLocation, PlayerLocation));
+			}
+
+			const float Score = AgeWeight * Fragment.Age / AgeScale
+				+ DistanceWeight * FMath::Sqrt(NearestDistSq) / DistanceScale
+				- ValueTerm;
+
+			Candidates.Add({ c, i, Score });
+		}
+	}
+
+	const int32 Excess = FMath::Min(LiveFragmentCount - Budget, Candidates.Num());
+	if (Excess <= 0) return 0;
+
+	// Worst-ranked first.
+	Candidates.Sort([](const FCandidate& A, const FCandidate& B)
+	{
+		return A.Score > B.Score;
+	});
+
+	TMap<int32, TArray<int32>> ToRemoveByCollection;
+	for (int32 k = 0; k < Excess; ++k)
+	{
+		const FCandidate& Candidate = Candidates[k];
+		Collections[Candidate.CollectionIndex].Fragments[Candidate.FragmentIndex].Stage = ECatDebrisStage::Removed;
+		ToRemoveByCollection.FindOrAdd(Candidate.CollectionIndex).Add(Candidate.FragmentIndex);
+	}
+
+	for (TPair<int32, TArray<int32>>& Pair : ToRemoveByCollection)
+	{
+		if (FGeometryCollectionPhysicsProxy* Proxy = Collections[Pair.Key].GCC->GetPhysicsProxy())
+		{
+			Proxy->DisableParticles_External(MoveTemp(Pair.Value));
+		}
+	}
+
+	return Excess;
+}
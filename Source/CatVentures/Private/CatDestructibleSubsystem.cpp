@@ -0,0 +1,868 @@
+// CatDestructibleSubsystem.cpp
+
+#include "CatDestructibleSubsystem.h"
+#include "CatChaosItemComponent.h"
+#include "CatGameMode.h"
+#include "CatGameState.h"
+#include "CatHeroBreakComponent.h"
+#include "CatVentures.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "EventManager.h"
+#include "EventsData.h"
+#include "GeometryCollection/GeometryCollection.h"
+#include "GeometryCollection/GeometryCollectionComponent.h"
+#include "GeometryCollection/GeometryCollectionObject.h"
+#include "GeometryCollection/Facades/CollectionDynamicStateFacade.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Crc.h"
+#include "Physics/Experimental/PhysScene_Chaos.h"
+#include "PhysicsProxy/GeometryCollectionPhysicsProxy.h"
+#include "PhysicsSolver.h"
+#include "UObject/UnrealType.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Break Events Received"), STAT_CatBreakEventsReceived, STATGROUP_CatVentures);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Break Events Reported"), STAT_CatBreakEventsReported, STATGROUP_CatVentures);
+DECLARE_CYCLE_STAT(TEXT("Break Event Handling"), STAT_CatBreakEventHandling, STATGROUP_CatVentures);
+DECLARE_CYCLE_STAT(TEXT("Destruction State Capture"), STAT_CatDestructionCapture, STATGROUP_CatVentures);
+DECLARE_CYCLE_STAT(TEXT("Destruction State Reapply"), STAT_CatDestructionReapply, STATGROUP_CatVentures);
+
+// ── Console ─────────────────────────────────────────────────────────────
+
+static TAutoConsoleVariable<bool> CVarCatPersistDebrisTransforms(
+	TEXT("cat.Destruction.PersistDebrisTransforms"),
+	true,
+	TEXT("Keep settled debris poses when a cell streams out. ")
+	TEXT("Off = broken-off fragments are dropped on stream-in and only the intact remainder is restored."));
+
+static TAutoConsoleVariable<int32> CVarCatReplayFracturesPerFrame(
+	TEXT("cat.Destruction.ReplayFracturesPerFrame"),
+	4,
+	TEXT("Deferred fractures (join snapshot, log entries for unloaded cells) replayed per frame once their ")
+	TEXT("props register. Each one wakes a GC, so a streamed-in cell full of broken props is spread out."));
+
+static TAutoConsoleVariable<float> CVarCatScoreBrokenFraction(
+	TEXT("cat.Destruction.ScoreBrokenFraction"),
+	0.5f,
+	TEXT("Share of a prop's pieces (0-1) that must have broken off before it scores as destroyed. ")
+	TEXT("A fully shattered prop always scores; a chip below this doesn't."));
+
+UCatDestructibleSubsystem* UCatDestructibleSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UCatDestructibleSubsystem>() : nullptr;
+}
+
+bool UCatDestructibleSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UCatDestructibleSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCatDestructibleSubsystem, STATGROUP_Tickables);
+}
+
+void UCatDestructibleSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	LevelAddedHandle     = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UCatDestructibleSubsystem::HandleLevelAdded);
+	LevelPreRemoveHandle = FWorldDelegates::PreLevelRemovedFromWorld.AddUObject(this, &UCatDestructibleSubsystem::HandleLevelPreRemove);
+	LevelRemovedHandle   = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &UCatDestructibleSubsystem::HandleLevelRemoved);
+}
+
+void UCatDestructibleSubsystem::Deinitialize()
+{
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::PreLevelRemovedFromWorld.Remove(LevelPreRemoveHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+
+	StopBreakListener();
+
+	Entries.Reset();
+	IdsByActor.Reset();
+	Cells.Reset();
+	MovingIds.Reset();
+	CellStates.Reset();
+	DeferredFractures.Reset();
+
+	Super::Deinitialize();
+}
+
+void UCatDestructibleSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Scoring is server-only — clients never listen.
+	if (InWorld.GetNetMode() != NM_Client)
+	{
+		StartBreakListener();
+	}
+
+	for (TActorIterator<AActor> It(&InWorld); It; ++It)
+	{
+		RegisterActor(*It);
+	}
+
+	bReplayDeferred = !DeferredFractures.IsEmpty();
+}
+
+void UCatDestructibleSubsystem::Tick(float DeltaTime)
+{
+	if (bReplayDeferred)
+	{
+		ReplayDeferredFractures();
+	}
+
+	if (!MovingIds.IsEmpty())
+	{
+		UpdateMovingEntries();
+	}
+}
+
+// ── Level streaming ─────────────────────────────────────────────────
+
+void UCatDestructibleSubsystem::HandleLevelAdded(ULevel* Level, UWorld* InWorld)
+{
+	if (InWorld != GetWorld()) return;
+
+	RegisterLevel(Level);
+
+	// Rebuild whatever was broken when this cell last streamed out.
+	TMap<uint32, FCatPropDestructionState> Stored;
+	if (Level && CellStates.RemoveAndCopyValue(GetLevelKey(Level), Stored))
+	{
+		SCOPE_CYCLE_COUNTER(STAT_CatDestructionReapply);
+
+		for (const TPair<uint32, FCatPropDestructionState>& Pair : Stored)
+		{
+			if (FCatDestructibleEntry* Entry = Entries.Find(Pair.Key))
+			{
+				ReapplyDestructionState(*Entry, Pair.Value);
+				NotifyMoving(Pair.Key);
+			}
+		}
+	}
+
+	// Then, over the next frames, anything that broke while this peer had never loaded the prop.
+	bReplayDeferred = !DeferredFractures.IsEmpty();
+}
+
+void UCatDestructibleSubsystem::HandleLevelPreRemove(ULevel* Level, UWorld* InWorld)
+{
+	// Components are still registered here — capture before the level tears them down.
+	if (InWorld != GetWorld() || !Level) return;
+
+	SCOPE_CYCLE_COUNTER(STAT_CatDestructionCapture);
+
+	// Any break counts, not just a full shatter — graded hits leave most props chipped.
+	TMap<uint32, FCatPropDestructionState> Captured;
+	for (const AActor* Actor : Level->Actors)
+	{
+		const FCatDestructibleEntry* Entry = FindByActor(Actor);
+		if (!Entry) continue;
+
+		FCatPropDestructionState State;
+		if (CaptureDestructionState(*Entry, State))
+		{
+			Captured.Add(Entry->Id, MoveTemp(State));
+		}
+	}
+
+	if (!Captured.IsEmpty())
+	{
+		CellStates.Add(GetLevelKey(Level), MoveTemp(Captured));
+	}
+}
+
+void UCatDestructibleSubsystem::HandleLevelRemoved(ULevel* Level, UWorld* InWorld)
+{
+	if (InWorld != GetWorld()) return;
+
+	// Null level = the whole world is going away.
+	if (!Level)
+	{
+		Entries.Reset();
+		IdsByActor.Reset();
+		Cells.Reset();
+		MovingIds.Reset();
+		CellStates.Reset();
+		DeferredFractures.Reset();
+		bReplayDeferred = false;
+		return;
+	}
+
+	for (AActor* Actor : Level->Actors)
+	{
+		UnregisterActor(Actor);
+	}
+}
+
+void UCatDestructibleSubsystem::RegisterLevel(ULevel* Level)
+{
+	if (!Level) return;
+
+	for (AActor* Actor : Level->Actors)
+	{
+		RegisterActor(Actor);
+	}
+}
+
+// ── Registration ────────────────────────────────────────────────────
+
+uint32 UCatDestructibleSubsystem::RegisterActor(AActor* Actor)
+{
+	if (!IsValid(Actor)) return InvalidId;
+
+	if (const uint32* Existing = IdsByActor.Find(Actor))
+	{
+		return *Existing;
+	}
+
+	// Only level-placed actors resolve to the same name on every peer.
+	if (!Actor->IsNameStableForNetworking()) return InvalidId;
+
+	UGeometryCollectionComponent* GCC = Actor->FindComponentByClass<UGeometryCollectionComponent>();
+	if (!GCC) return InvalidId;
+
+	const FString StablePath = UWorld::RemovePIEPrefix(Actor->GetPathName());
+	uint32 Id = FCrc::StrCrc32(*StablePath);
+	if (Id == InvalidId) Id = 1;
+
+	if (const FCatDestructibleEntry* Clash = Entries.Find(Id))
+	{
+		// Vanishingly rare with level-sized prop counts. Fail loudly rather than alias two props.
+		UE_LOG(LogTemp, Error, TEXT("UCatDestructibleSubsystem — ID clash between '%s' and '%s'; '%s' is not registered."),
+			*StablePath, Clash->Actor.IsValid() ? *Clash->Actor->GetPathName() : TEXT("<stale>"), *StablePath);
+		return InvalidId;
+	}
+
+	const FBoxSphereBounds Bounds = GCC->Bounds;
+
+	FCatDestructibleEntry& Entry = Entries.Add(Id);
+	Entry.Id        = Id;
+	Entry.Actor     = Actor;
+	Entry.GCC       = GCC;
+	Entry.Hero      = Actor->FindComponentByClass<UCatHeroBreakComponent>();
+	Entry.Item      = Actor->FindComponentByClass<UCatChaosItemComponent>();
+	Entry.RewardKey = Entry.Item.IsValid() ? Entry.Item->ChaosRewardKey : ReadRewardKey(Actor);
+	Entry.Center    = Bounds.Origin;
+	Entry.Radius    = Bounds.SphereRadius;
+	Entry.Cell      = ToCell(Bounds.Origin);
+
+	// Opt in to Breaking events — the solver only generates them for GCs that ask.
+	if (bListeningForBreaks)
+	{
+		GCC->SetNotifyBreaks(true);
+	}
+
+	IdsByActor.Add(Actor, Id);
+	Cells.FindOrAdd(Entry.Cell).Add(Id);
+	MaxEntryRadius = FMath::Max(MaxEntryRadius, Entry.Radius);
+
+	return Id;
+}
+
+void UCatDestructibleSubsystem::UnregisterActor(const AActor* Actor)
+{
+	if (!Actor) return;
+
+	uint32 Id = InvalidId;
+	if (!IdsByActor.RemoveAndCopyValue(Actor, Id)) return;
+
+	FCatDestructibleEntry Entry;
+	if (!Entries.RemoveAndCopyValue(Id, Entry)) return;
+
+	MovingIds.Remove(Id);
+
+	if (TArray<uint32>* Cell = Cells.Find(Entry.Cell))
+	{
+		Cell->RemoveSwap(Id);
+		if (Cell->IsEmpty())
+		{
+			Cells.Remove(Entry.Cell);
+		}
+	}
+}
+
+FName UCatDestructibleSubsystem::GetLevelKey(const ULevel* Level)
+{
+	// The outermost package is the cell's — stable across unload/reload, unlike the ULevel.
+	return Level->GetOutermost()->GetFName();
+}
+
+FName UCatDestructibleSubsystem::ReadRewardKey(const AActor* Actor)
+{
+	// Legacy BPC_ChaosItem is a Blueprint component — read its ChaosRewardKey variable by name.
+	static const FName RewardKeyName(TEXT("ChaosRewardKey"));
+
+	for (const UActorComponent* Component : Actor->GetComponents())
+	{
+		if (!Component) continue;
+
+		if (const FNameProperty* Prop = FindFProperty<FNameProperty>(Component->GetClass(), RewardKeyName))
+		{
+			return Prop->GetPropertyValue_InContainer(Component);
+		}
+	}
+	return NAME_None;
+}
+
+// ── Lookups ─────────────────────────────────────────────────────────
+
+const FCatDestructibleEntry* UCatDestructibleSubsystem::Find(uint32 Id) const
+{
+	const FCatDestructibleEntry* Entry = Entries.Find(Id);
+	return (Entry && Entry->Actor.IsValid()) ? Entry : nullptr;
+}
+
+const FCatDestructibleEntry* UCatDestructibleSubsystem::FindByActor(const AActor* Actor) const
+{
+	const uint32* Id = Actor ? IdsByActor.Find(Actor) : nullptr;
+	return Id ? Find(*Id) : nullptr;
+}
+
+uint32 UCatDestructibleSubsystem::GetId(const AActor* Actor) const
+{
+	const FCatDestructibleEntry* Entry = FindByActor(Actor);
+	return Entry ? Entry->Id : InvalidId;
+}
+
+AActor* UCatDestructibleSubsystem::ResolveActor(uint32 Id) const
+{
+	const FCatDestructibleEntry* Entry = Find(Id);
+	return Entry ? Entry->Actor.Get() : nullptr;
+}
+
+UGeometryCollectionComponent* UCatDestructibleSubsystem::ResolveGC(uint32 Id) const
+{
+	const FCatDestructibleEntry* Entry = Find(Id);
+	return Entry ? Entry->GCC.Get() : nullptr;
+}
+
+FIntVector UCatDestructibleSubsystem::ToCell(const FVector& Location)
+{
+	return FIntVector(
+		FMath::FloorToInt(Location.X / CellSize),
+		FMath::FloorToInt(Location.Y / CellSize),
+		FMath::FloorToInt(Location.Z / CellSize));
+}
+
+void UCatDestructibleSubsystem::QueryRadius(const FVector& Center, float Radius, TArray<uint32>& OutIds) const
+{
+	// Entries live in their centre's cell only, so widen by the largest entry radius.
+	const float Reach = Radius + MaxEntryRadius;
+	const FIntVector MinCell = ToCell(Center - FVector(Reach));
+	const FIntVector MaxCell = ToCell(Center + FVector(Reach));
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+	for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+	{
+		const TArray<uint32>* Cell = Cells.Find(FIntVector(X, Y, Z));
+		if (!Cell) continue;
+
+		for (const uint32 Id : *Cell)
+		{
+			const FCatDestructibleEntry& Entry = Entries.FindChecked(Id);
+			if (FVector::DistSquared(Entry.Center, Center) <= FMath::Square(Radius + Entry.Radius))
+			{
+				OutIds.Add(Id);
+			}
+		}
+	}
+}
+
+void UCatDestructibleSubsystem::NotifyMoving(uint32 Id)
+{
+	if (!Entries.Contains(Id)) return;
+
+	// Restart the settle count — a prop pushed again mid-slide stays tracked.
+	MovingIds.Add(Id, 0);
+}
+
+void UCatDestructibleSubsystem::UpdateMovingEntries()
+{
+	for (auto It = MovingIds.CreateIterator(); It; ++It)
+	{
+		FCatDestructibleEntry* Entry = Entries.Find(It.Key());
+		const UGeometryCollectionComponent* GCC = Entry ? Entry->GCC.Get() : nullptr;
+		if (!GCC)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		// Simulated GC pieces don't move the component — its bounds follow them.
+		const FVector Center = GCC->Bounds.Origin;
+		if (FVector::DistSquared(Center, Entry->Center) > FMath::Square(MovingTolerance))
+		{
+			MoveEntry(*Entry, Center);
+			It.Value() = 0;
+		}
+		else if (++It.Value() >= MovingSettleTicks)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UCatDestructibleSubsystem::MoveEntry(FCatDestructibleEntry& Entry, const FVector& NewCenter)
+{
+	Entry.Center = NewCenter;
+
+	const FIntVector NewCell = ToCell(NewCenter);
+	if (NewCell == Entry.Cell) return;
+
+	if (TArray<uint32>* OldCell = Cells.Find(Entry.Cell))
+	{
+		OldCell->RemoveSwap(Entry.Id);
+		if (OldCell->IsEmpty())
+		{
+			Cells.Remove(Entry.Cell);
+		}
+	}
+
+	Entry.Cell = NewCell;
+	Cells.FindOrAdd(NewCell).Add(Entry.Id);
+}
+
+void UCatDestructibleSubsystem::MarkShattered(uint32 Id)
+{
+	if (FCatDestructibleEntry* Entry = Entries.Find(Id))
+	{
+		Entry->bShattered = true;
+	}
+}
+
+bool UCatDestructibleSubsystem::IsShattered(uint32 Id) const
+{
+	const FCatDestructibleEntry* Entry = Find(Id);
+	return Entry && Entry->bShattered;
+}
+
+bool UCatDestructibleSubsystem::CanApplyFracture(uint32 Id) const
+{
+	// Before begin play a client's props can be registered but not yet simulating, and
+	// graded replays need the GameState's tuning rows.
+	const UWorld* World = GetWorld();
+	return Find(Id) && World->HasBegunPlay() && World->GetGameState<ACatGameState>();
+}
+
+void UCatDestructibleSubsystem::ApplyOrDeferFracture(const FCatFractureEvent& Event, bool bPlayEffects)
+{
+	if (Event.DestructibleId == InvalidId) return;
+
+	// Queue behind any older fractures of the same prop still waiting — hits replay in order.
+	TArray<FCatFractureEvent>* Waiting = DeferredFractures.Find(Event.DestructibleId);
+	if (Waiting || !CanApplyFracture(Event.DestructibleId))
+	{
+		if (Waiting)
+		{
+			Waiting->Add(Event);
+			bReplayDeferred = true;
+		}
+		else
+		{
+			DeferredFractures.Add(Event.DestructibleId).Add(Event);
+		}
+		return;
+	}
+
+	GetWorld()->GetGameState<ACatGameState>()->ApplyFractureEvent(Event, bPlayEffects);
+}
+
+void UCatDestructibleSubsystem::ReplayDeferredFractures()
+{
+	int32 Budget = FMath::Max(CVarCatReplayFracturesPerFrame.GetValueOnGameThread(), 1);
+	bool bAnyResolvable = false;
+
+	for (auto It = DeferredFractures.CreateIterator(); It; ++It)
+	{
+		if (!CanApplyFracture(It.Key())) continue;
+
+		if (Budget == 0)
+		{
+			bAnyResolvable = true;
+			break;
+		}
+
+		TArray<FCatFractureEvent>& Events = It.Value();
+		const int32 Count = FMath::Min(Budget, Events.Num());
+
+		const ACatGameState* GS = GetWorld()->GetGameState<ACatGameState>();
+		for (int32 i = 0; i < Count; ++i)
+		{
+			GS->ApplyFractureEvent(Events[i], /*bPlayEffects=*/false);
+		}
+		Budget -= Count;
+
+		Events.RemoveAt(0, Count);
+		if (Events.IsEmpty())
+		{
+			It.RemoveCurrent();
+		}
+		else
+		{
+			bAnyResolvable = true;
+		}
+	}
+
+	// Nothing left that can play now; the next registration re-arms the replay.
+	bReplayDeferred = bAnyResolvable;
+}
+
+bool UCatDestructibleSubsystem::TryMarkReported(uint32 Id)
+{
+	FCatDestructibleEntry* Entry = Entries.Find(Id);
+	if (!Entry || Entry->bReported) return false;
+
+	Entry->bReported = true;
+	return true;
+}
+
+void UCatDestructibleSubsystem::ResetDestructibles()
+{
+	CellStates.Reset();
+	DeferredFractures.Reset();
+	bReplayDeferred = false;
+
+	for (TPair<uint32, FCatDestructibleEntry>& Pair : Entries)
+	{
+		FCatDestructibleEntry& Entry = Pair.Value;
+		Entry.bShattered = false;
+		Entry.bReported  = false;
+
+		// Tear the proxy down, reassign the asset to rebuild the dynamic collection from rest,
+		// and build a fresh proxy: every cluster rejoined, disabled debris back.
+		if (UGeometryCollectionComponent* GCC = Entry.GCC.Get())
+		{
+			// A stream-in reapply's pins and settled rest pose belong to the old match.
+			for (const int32 Index : Entry.ReappliedAnchors)
+			{
+				GCC->SetAnchoredByIndex(Index, false);
+			}
+
+			GCC->DestroyPhysicsState();
+
+			const UGeometryCollection* Rest = GCC->GetRestCollection();
+			const TSharedPtr<FGeometryCollection, ESPMode::ThreadSafe> Collection = Rest ? Rest->GetGeometryCollection() : nullptr;
+			if (Entry.bRestStateOverridden && Collection)
+			{
+				TArray<FTransform> AssetTransforms;
+				AssetTransforms.Reserve(Collection->Transform.Num());
+				for (int32 i = 0; i < Collection->Transform.Num(); ++i)
+				{
+					AssetTransforms.Add(FTransform(Collection->Transform[i]));
+				}
+				GCC->SetRestState(MoveTemp(AssetTransforms));
+			}
+
+			GCC->SetRestCollection(Rest);
+			GCC->RecreatePhysicsState();
+		}
+		Entry.bRestStateOverridden = false;
+		Entry.ReappliedAnchors.Reset();
+
+		// Back at its placed pose — re-bucket from wherever it was pushed to.
+		NotifyMoving(Entry.Id);
+
+		if (UCatHeroBreakComponent* Hero = Entry.Hero.Get())
+		{
+			Hero->ResetBreak();
+		}
+
+		if (UCatChaosItemComponent* Item = Entry.Item.Get())
+		{
+			Item->ResetItem();
+		}
+	}
+}
+
+bool UCatDestructibleSubsystem::IsInReach(uint32 Id, const FVector& From, float Reach) const
+{
+	const FCatDestructibleEntry* Entry = Find(Id);
+	const UGeometryCollectionComponent* GCC = Entry ? Entry->GCC.Get() : nullptr;
+	if (!GCC) return false;
+
+	// Bumper pushes move intact props, so measure from where the GC is now.
+	const FBoxSphereBounds& Bounds = GCC->Bounds;
+	return FVector::DistSquared(Bounds.Origin, From) <= FMath::Square(Reach + Bounds.SphereRadius);
+}
+
+bool UCatDestructibleSubsystem::HasCrossedScoreThreshold(const FCatDestructibleEntry& Entry) const
+{
+	if (Entry.bShattered) return true;
+
+	UGeometryCollectionComponent* GCC = Entry.GCC.Get();
+	FGeometryDynamicCollection* DynCollection = GCC ? GCC->GetDynamicCollection() : nullptr;
+	if (!DynCollection) return false;
+
+	FGeometryCollectionDynamicStateFacade StateFacade(*DynCollection);
+	const int32 NumTransforms = GCC->GetComponentSpaceTransforms3f().Num();
+	if (NumTransforms <= 1) return false;
+
+	int32 NumBrokenOff = 0;
+	bool bAnyIntactCluster = false;
+	for (int32 i = 0; i < NumTransforms; ++i)
+	{
+		if (StateFacade.HasBrokenOff(i))
+		{
+			++NumBrokenOff;
+		}
+		else if (StateFacade.HasChildren(i) && StateFacade.IsActive(i))
+		{
+			bAnyIntactCluster = true;
+		}
+	}
+
+	// Nothing left holding together counts as a shatter, whatever the share.
+	if (NumBrokenOff > 0 && !bAnyIntactCluster) return true;
+
+	// The root never breaks off — it's the whole prop.
+	const float BrokenFraction = static_cast<float>(NumBrokenOff) / (NumTransforms - 1);
+	return BrokenFraction >= FMath::Clamp(CVarCatScoreBrokenFraction.GetValueOnGameThread(), 0.0f, 1.0f);
+}
+
+// ── Streaming persistence ───────────────────────────────────────────
+
+bool UCatDestructibleSubsystem::CaptureDestructionState(const FCatDestructibleEntry& Entry, FCatPropDestructionState& OutState)
+{
+	UGeometryCollectionComponent* GCC = Entry.GCC.Get();
+	FGeometryDynamicCollection* DynCollection = GCC ? GCC->GetDynamicCollection() : nullptr;
+	if (!DynCollection) return false;
+
+	FGeometryCollectionDynamicStateFacade StateFacade(*DynCollection);
+	const TArray<FTransform3f>& Transforms = GCC->GetComponentSpaceTransforms3f();
+	const int32 NumTransforms = Transforms.Num();
+
+	OutState.BrokenOff.Init(false, NumTransforms);
+	OutState.Removed.Init(false, NumTransforms);
+
+	bool bAnyBroken = false;
+	bool bAnyIntactCluster = false;
+	for (int32 i = 0; i < NumTransforms; ++i)
+	{
+		if (StateFacade.HasChildren(i) && StateFacade.IsActive(i))
+		{
+			bAnyIntactCluster = true;
+		}
+
+		if (!StateFacade.HasBrokenOff(i)) continue;
+
+		bAnyBroken = true;
+		OutState.BrokenOff[i] = true;
+		OutState.Removed[i]   = !StateFacade.HasChildren(i) && !StateFacade.IsActive(i);
+	}
+
+	// Scored but unbroken (a Blueprint report) still needs its flag carried over.
+	if (!bAnyBroken && !Entry.bReported) return false;
+
+	if (bAnyBroken && CVarCatPersistDebrisTransforms.GetValueOnGameThread())
+	{
+		OutState.SettledTransforms = Transforms;
+	}
+
+	OutState.bReported  = Entry.bReported;
+	OutState.bShattered = Entry.bShattered || (bAnyBroken && !bAnyIntactCluster);
+	return true;
+}
+
+void UCatDestructibleSubsystem::ReapplyDestructionState(FCatDestructibleEntry& Entry, const FCatPropDestructionState& State)
+{
+	Entry.bShattered = State.bShattered;
+	Entry.bReported  = State.bReported;
+
+	UGeometryCollectionComponent* GCC = Entry.GCC.Get();
+	const UGeometryCollection* Rest = GCC ? GCC->GetRestCollection() : nullptr;
+	const TSharedPtr<FGeometryCollection, ESPMode::ThreadSafe> Collection = Rest ? Rest->GetGeometryCollection() : nullptr;
+	if (!Collection) return;
+
+	const int32 NumTransforms = Collection->NumElements(FGeometryCollection::TransformGroup);
+	if (State.BrokenOff.Num() != NumTransforms) return;	// Asset changed since capture.
+	if (State.BrokenOff.Find(true) == INDEX_NONE) return;	// Scored, never broken.
+
+	const bool bHasPoses = State.SettledTransforms.Num() == NumTransforms;
+
+	// Settled pose → rest pose. GC rest transforms are parent-relative, so each captured
+	// component-space pose is expressed against its parent's captured pose.
+	if (bHasPoses)
+	{
+		TArray<FTransform> RestTransforms;
+		RestTransforms.SetNum(NumTransforms);
+		for (int32 i = 0; i < NumTransforms; ++i)
+		{
+			const int32 Parent = Collection->Parent[i];
+			const FTransform Pose(State.SettledTransforms[i]);
+			RestTransforms[i] = Parent == FGeometryCollection::Invalid
+				? Pose : Pose.GetRelativeTransform(FTransform(State.SettledTransforms[Parent]));
+		}
+
+		GCC->DestroyPhysicsState();
+		GCC->SetRestState(MoveTemp(RestTransforms));
+		GCC->RecreatePhysicsState();
+		Entry.bRestStateOverridden = true;
+	}
+
+	// Loose: the transform or one of its ancestors broke off.
+	TBitArray<> Loose(false, NumTransforms);
+	for (int32 i = 0; i < NumTransforms; ++i)
+	{
+		for (int32 Node = i; Node != FGeometryCollection::Invalid; Node = Collection->Parent[Node])
+		{
+			if (State.BrokenOff[Node])
+			{
+				Loose[i] = true;
+				break;
+			}
+		}
+	}
+
+	// Release the clusters — no strain, no sim. A shattered prop releases everything; a
+	// chipped one only the clusters that had let pieces go, parents first so each crumble
+	// finds its cluster already active. The rest of the prop stays whole and dynamic.
+	TBitArray<> Crumbled(State.bShattered, NumTransforms);
+	if (State.bShattered)
+	{
+		GCC->CrumbleActiveClusters();
+	}
+	else
+	{
+		TArray<TPair<int32, int32>> ToCrumble;	// (depth, cluster)
+		for (int32 i = 0; i < NumTransforms; ++i)
+		{
+			const int32 Parent = Collection->Parent[i];
+			if (!State.BrokenOff[i] || Parent == FGeometryCollection::Invalid || Crumbled[Parent]) continue;
+
+			Crumbled[Parent] = true;
+			int32 Depth = 0;
+			for (int32 Node = Parent; Collection->Parent[Node] != FGeometryCollection::Invalid; Node = Collection->Parent[Node])
+			{
+				++Depth;
+			}
+			ToCrumble.Emplace(Depth, Parent);
+		}
+
+		ToCrumble.Sort([](const TPair<int32, int32>& A, const TPair<int32, int32>& B) { return A.Key < B.Key; });
+		for (const TPair<int32, int32>& Cluster : ToCrumble)
+		{
+			GCC->CrumbleCluster(Cluster.Value);
+		}
+	}
+
+	// Pin every leaf a crumble freed where it lay. Unbroken siblings freed by the same
+	// crumble are pinned too, so they don't drop out of place.
+	TArray<int32> ToDisable;
+	for (int32 i = 0; i < NumTransforms; ++i)
+	{
+		if (Collection->Children[i].Num() > 0) continue;
+
+		// Without poses a broken leaf would reappear in its intact slot — drop it instead.
+		if (State.Removed[i] || (!bHasPoses && Loose[i]))
+		{
+			ToDisable.Add(i);
+			continue;
+		}
+
+		bool bFreed = false;
+		for (int32 Node = Collection->Parent[i]; Node != FGeometryCollection::Invalid && !bFreed; Node = Collection->Parent[Node])
+		{
+			bFreed = Crumbled[Node];
+		}
+		if (bFreed)
+		{
+			GCC->SetAnchoredByIndex(i, true);
+			Entry.ReappliedAnchors.Add(i);
+		}
+	}
+
+	if (ToDisable.Num() > 0)
+	{
+		if (FGeometryCollectionPhysicsProxy* Proxy = GCC->GetPhysicsProxy())
+		{
+			Proxy->DisableParticles_External(MoveTemp(ToDisable));
+		}
+	}
+}
+
+// ── Break ingestion ─────────────────────────────────────────────────
+
+void UCatDestructibleSubsystem::StartBreakListener()
+{
+	if (bListeningForBreaks) return;
+
+	FPhysScene* Scene = GetWorld()->GetPhysicsScene();
+	Chaos::FPhysicsSolver* Solver = Scene ? Scene->GetSolver() : nullptr;
+	if (!Solver) return;
+
+	Solver->SetGenerateBreakingData(true);
+	Solver->GetEventManager()->RegisterHandler<Chaos::FBreakingEventData>(
+		Chaos::EEventType::Breaking, this, &UCatDestructibleSubsystem::HandleBreakingEvents);
+	bListeningForBreaks = true;
+
+	// Levels that streamed in before play registered without break notifications.
+	for (const TPair<uint32, FCatDestructibleEntry>& Pair : Entries)
+	{
+		if (UGeometryCollectionComponent* GCC = Pair.Value.GCC.Get())
+		{
+			GCC->SetNotifyBreaks(true);
+		}
+	}
+}
+
+void UCatDestructibleSubsystem::StopBreakListener()
+{
+	if (!bListeningForBreaks) return;
+	bListeningForBreaks = false;
+
+	const UWorld* World = GetWorld();
+	FPhysScene* Scene = World ? World->GetPhysicsScene() : nullptr;
+	Chaos::FPhysicsSolver* Solver = Scene ? Scene->GetSolver() : nullptr;
+	if (Solver)
+	{
+		Solver->GetEventManager()->UnregisterHandler(Chaos::EEventType::Breaking, this);
+	}
+}
+
+void UCatDestructibleSubsystem::HandleBreakingEvents(const Chaos::FBreakingEventData& Event)
+{
+	SCOPE_CYCLE_COUNTER(STAT_CatBreakEventHandling);
+
+	const FPhysScene* Scene = GetWorld()->GetPhysicsScene();
+	if (!Scene) return;
+
+	const TArray<Chaos::FBreakingData>& Breaks = Event.BreakingData.AllBreakingsArray;
+	INC_DWORD_STAT_BY(STAT_CatBreakEventsReceived, Breaks.Num());
+
+	// A shattering prop emits one break per cluster — judge each prop once per batch, after
+	// the whole batch has landed in its dynamic state, and only until it has scored.
+	TArray<FCatBreakReport> Reports;
+	TSet<const IPhysicsProxyBase*> SeenProxies;
+
+	for (const Chaos::FBreakingData& Break : Breaks)
+	{
+		if (!Break.Proxy) continue;
+
+		bool bSeen = false;
+		SeenProxies.Add(Break.Proxy, &bSeen);
+		if (bSeen) continue;
+
+		const UGeometryCollectionComponent* GCC = Scene->GetOwningComponent<UGeometryCollectionComponent>(Break.Proxy);
+		const FCatDestructibleEntry* Entry = GCC ? FindByActor(GCC->GetOwner()) : nullptr;
+		if (!Entry || Entry->bReported || !HasCrossedScoreThreshold(*Entry)) continue;
+
+		TryMarkReported(Entry->Id);
+		Reports.Add(FCatBreakReport{ Entry->Id, FVector(Break.Location) });
+	}
+
+	if (Reports.IsEmpty()) return;
+
+	INC_DWORD_STAT_BY(STAT_CatBreakEventsReported, Reports.Num());
+
+	if (ACatGameMode* GM = GetWorld()->GetAuthGameMode<ACatGameMode>())
+	{
+		GM->ReportItemsDestroyed(Reports);
+	}
+}
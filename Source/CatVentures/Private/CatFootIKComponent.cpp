@@ -0,0 +1,142 @@
+// CatFootIKComponent.cpp
+
+#include "CatFootIKComponent.h"
+#include "CatFootIKSubsystem.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Engine/World.h"
+
+UCatFootIKComponent::UCatFootIKComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+
+	// Front paws, then hind paws — matches the AnimX skeleton socket naming.
+	FootSockets = {
+		TEXT("socket_paw_l"),
+		TEXT("socket_paw_r"),
+		TEXT("socket_foot_l"),
+		TEXT("socket_foot_r")
+	};
+}
+
+void UCatFootIKComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	Paws.SetNum(FootSockets.Num());
+	Pose.FootOffsets.Init(0.0f, FootSockets.Num());
+	Pose.FootRotations.Init(FRotator::ZeroRotator, FootSockets.Num());
+
+	// Subsystem is absent on dedicated servers — the component then stays inert.
+	if (UCatFootIKSubsystem* FootIK = GetWorld()->GetSubsystem<UCatFootIKSubsystem>())
+	{
+		FootIK->RegisterComponent(this);
+	}
+}
+
+void UCatFootIKComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UCatFootIKSubsystem* FootIK = GetWorld()->GetSubsystem<UCatFootIKSubsystem>())
+	{
+		FootIK->UnregisterComponent(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+USkeletalMeshComponent* UCatFootIKComponent::GetOwnerMesh() const
+{
+	const ACharacter* Character = Cast<ACharacter>(GetOwner());
+	return Character ? Character->GetMesh() : nullptr;
+}
+
+bool UCatFootIKComponent::ShouldTrace() const
+{
+	const ACharacter* Character = Cast<ACharacter>(GetOwner());
+	if (!Character) return false;
+
+	// Airborne — the jump/fall poses own the legs and there's no ground to reach.
+	const UCharacterMovementComponent* CMC = Character->GetCharacterMovement();
+	if (!CMC || !CMC->IsMovingOnGround()) return false;
+
+	// Off-screen — nobody would see the paws land.
+	const USkeletalMeshComponent* Mesh = Character->GetMesh();
+	return Mesh && Mesh->WasRecentlyRendered(OffScreenTimeout);
+}
+
+// ── Pass 1: consume ─────────────────────────────────────────────────
+
+void UCatFootIKComponent::ConsumeTraceResults(UWorld* World, float DeltaTime)
+{
+	const USkeletalMeshComponent* Mesh = GetOwnerMesh();
+	if (!Mesh) return;
+
+	const float MeshZ = Mesh->GetComponentLocation().Z;
+	float LowestOffset = 0.0f;
+
+	for (int32 i = 0; i < Paws.Num(); ++i)
+	{
+		FPawTrace& Paw = Paws[i];
+
+		if (Paw.Handle.IsValid())
+		{
+			FTraceDatum Datum;
+			if (World->QueryTraceData(Paw.Handle, Datum))
+			{
+				if (Datum.OutHits.Num() > 0 && Datum.OutHits[0].bBlockingHit)
+				{
+					const FHitResult& Hit = Datum.OutHits[0];
+					Paw.RawOffset = FMath::Clamp(Hit.ImpactPoint.Z - MeshZ, -MaxFootOffset, MaxFootOffset);
+
+					// Pad alignment: pitch/roll that tilts world-up onto the ground normal.
+					const FVector N = Hit.ImpactNormal;
+					Paw.RawRotation = FRotator(
+						-FMath::RadiansToDegrees(FMath::Atan2(N.X, N.Z)),
+						0.0f,
+						FMath::RadiansToDegrees(FMath::Atan2(N.Y, N.Z)));
+				}
+				else
+				{
+					// Nothing under the paw (ledge) — let it hang at the animated height.
+					Paw.RawOffset   = 0.0f;
+					Paw.RawRotation = FRotator::ZeroRotator;
+				}
+			}
+			Paw.Handle = FTraceHandle();
+		}
+
+		Pose.FootOffsets[i]   = FMath::FInterpTo(Pose.FootOffsets[i], Paw.RawOffset, DeltaTime, InterpSpeed);
+		Pose.FootRotations[i] = FMath::RInterpTo(Pose.FootRotations[i], Paw.RawRotation, DeltaTime, InterpSpeed);
+		LowestOffset = FMath::Min(LowestOffset, Paw.RawOffset);
+	}
+
+	Pose.PelvisOffset = FMath::FInterpTo(Pose.PelvisOffset, LowestOffset, DeltaTime, InterpSpeed);
+	Pose.Alpha        = FMath::FInterpTo(Pose.Alpha, bTracingActive ? 1.0f : 0.0f, DeltaTime, InterpSpeed);
+}
+
+// ── Pass 2: issue ───────────────────────────────────────────────────
+
+int32 UCatFootIKComponent::IssueTraces(UWorld* World)
+{
+	bTracingActive = ShouldTrace();
+	if (!bTracingActive) return 0;
+
+	const USkeletalMeshComponent* Mesh = GetOwnerMesh();
+	const float MeshZ = Mesh->GetComponentLocation().Z;
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(CatFootIK), /*bTraceComplex=*/false, GetOwner());
+
+	int32 Issued = 0;
+	for (int32 i = 0; i < Paws.Num(); ++i)
+	{
+		const FVector PawLocation = Mesh->GetSocketLocation(FootSockets[i]);
+		const FVector Start(PawLocation.X, PawLocation.Y, MeshZ + TraceUpDistance);
+		const FVector End  (PawLocation.X, PawLocation.Y, MeshZ - TraceDownDistance);
+
+		Paws[i].Handle = World->AsyncLineTraceByChannel(
+			EAsyncTraceType::Single, Start, End, TraceChannel, Params);
+		++Issued;
+	}
+	return Issued;
+}
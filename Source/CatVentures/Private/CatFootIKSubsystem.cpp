@@ -0,0 +1,69 @@
+// CatFootIKSubsystem.cpp
+
+#include "CatFootIKSubsystem.h"
+#include "CatFootIKComponent.h"
+#include "CatVentures.h"
+#include "Engine/World.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Foot IK Async Traces"), STAT_CatFootIKTraces, STATGROUP_CatVentures);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Foot IK Cats Tracing"), STAT_CatFootIKCatsTracing, STATGROUP_CatVentures);
+DECLARE_CYCLE_STAT(TEXT("Foot IK Tick"), STAT_CatFootIKTick, STATGROUP_CatVentures);
+
+bool UCatFootIKSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return !IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+}
+
+bool UCatFootIKSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UCatFootIKSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCatFootIKSubsystem, STATGROUP_Tickables);
+}
+
+void UCatFootIKSubsystem::RegisterComponent(UCatFootIKComponent* Component)
+{
+	if (Component)
+	{
+		Components.AddUnique(Component);
+	}
+}
+
+void UCatFootIKSubsystem::UnregisterComponent(UCatFootIKComponent* Component)
+{
+	Components.RemoveSwap(Component);
+}
+
+void UCatFootIKSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_CatFootIKTick);
+
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	Components.RemoveAllSwap([](const TWeakObjectPtr<UCatFootIKComponent>& Comp) { return !Comp.IsValid(); });
+
+	// Pass 1 — every cat reads back the batch queued last frame before anyone queues
+	// the next one, so one frame's traces always complete as a single round.
+	for (const TWeakObjectPtr<UCatFootIKComponent>& Comp : Components)
+	{
+		Comp->ConsumeTraceResults(World, DeltaTime);
+	}
+
+	// Pass 2 — queue this frame's traces for all eligible cats.
+	int32 TracesIssued = 0;
+	int32 CatsTracing  = 0;
+	for (const TWeakObjectPtr<UCatFootIKComponent>& Comp : Components)
+	{
+		const int32 Issued = Comp->IssueTraces(World);
+		TracesIssued += Issued;
+		CatsTracing  += (Issued > 0) ? 1 : 0;
+	}
+
+	LastFrameTraceCount = TracesIssued;
+	SET_DWORD_STAT(STAT_CatFootIKTraces, TracesIssued);
+	SET_DWORD_STAT(STAT_CatFootIKCatsTracing, CatsTracing);
+}
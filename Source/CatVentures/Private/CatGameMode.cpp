@@ -1,9 +1,16 @@
 // CatGameMode.cpp
 
 #include "CatGameMode.h"
+#include "CatChaosItemComponent.h"
 #include "CatGameState.h"
 #include "CatPlayerController.h"
+#include "CatDebrisSubsystem.h"
+#include "CatDestructibleSubsystem.h"
 #include "Engine/DataTable.h"
+#include "Engine/Level.h"
+#include "GameFramework/Pawn.h"
+#include "GeometryCollection/GeometryCollectionComponent.h"
+#include "HAL/PlatformTime.h"
 #include "Kismet/GameplayStatics.h"
 
 void ACatGameMode::BeginPlay()
@@ -15,6 +22,41 @@ void ACatGameMode::BeginPlay()
 	{
 		GS->ChaosThreshold = ChaosThreshold;
 	}
+
+	// Rematch needs every toy's start pose — capture now and as World Partition cells arrive.
+	for (const ULevel* Level : GetWorld()->GetLevels())
+	{
+		CapturePropRestPoses(Level);
+	}
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &ACatGameMode::HandleLevelAdded);
+}
+
+void ACatGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ACatGameMode::PostLogin(APlayerController* NewPlayer)
+{
+	Super::PostLogin(NewPlayer);
+
+	// The host's own controller shares the server's solver — nothing to catch up on.
+	ACatPlayerController* PC = Cast<ACatPlayerController>(NewPlayer);
+	if (!PC || PC->IsLocalController()) return;
+
+	const ACatGameState* GS = GetGameState<ACatGameState>();
+	if (!GS || GS->GetDestructionSnapshot().IsEmpty()) return;
+
+	// Reliable RPCs on one channel arrive in order, so chunks reassemble as sent.
+	const TArray<FCatDestroyedGC>& Snapshot = GS->GetDestructionSnapshot();
+	for (int32 Start = 0; Start < Snapshot.Num(); Start += ACatPlayerController::SnapshotChunkSize)
+	{
+		const int32 Count = FMath::Min(ACatPlayerController::SnapshotChunkSize, Snapshot.Num() - Start);
+		PC->Client_ReceiveDestructionSnapshot(TArray<FCatDestroyedGC>(Snapshot.GetData() + Start, Count),
+			GS->GetDestructionSnapshotSequence(), /*bFirstChunk=*/Start == 0);
+	}
 }
 
 // ── Score Reporting ─────────────────────────────────────────────────
@@ -23,18 +65,80 @@ void ACatGameMode::ReportItemDestroyed(AActor* Item, FVector Location, FName Cha
 {
 	if (CurrentPhase != ECatMatchPhase::Playing) return;
 
-	// Resolve the reward row — missing row falls back to DefaultChaosValue.
+	// Registered props are scored exactly once, whichever path reports first.
+	UCatDestructibleSubsystem* Registry = UCatDestructibleSubsystem::Get(this);
+	const FCatDestructibleEntry* Entry = Registry ? Registry->FindByActor(Item) : nullptr;
+	if (Entry && !Registry->TryMarkReported(Entry->Id)) return;
+
+	const float Value = RecordDestroyedItem(Item, Entry, Location, ChaosRewardKey);
+
+	if (GEngine)
+	{
+		GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::Orange,
+			FString::Printf(TEXT("Chaos +%.0f  (%.0f / %.0f)"), Value, TotalChaosScore, ChaosThreshold));
+	}
+
+	CommitChaosScore(Item, Location);
+}
+
+void ACatGameMode::ReportItemsDestroyed(TConstArrayView<FCatBreakReport> Reports)
+{
+	if (CurrentPhase != ECatMatchPhase::Playing || Reports.IsEmpty()) return;
+
+	const UCatDestructibleSubsystem* Registry = UCatDestructibleSubsystem::Get(this);
+	if (!Registry) return;
+
+	AActor* LastItem = nullptr;
+	FVector LastLocation = FVector::ZeroVector;
+	float BatchValue = 0.0f;
+
+	for (const FCatBreakReport& Report : Reports)
+	{
+		const FCatDestructibleEntry* Entry = Registry->Find(Report.DestructibleId);
+		if (!Entry) continue;
+
+		LastItem = Entry->Actor.Get();
+		LastLocation = Report.Location;
+		BatchValue += RecordDestroyedItem(LastItem, Entry, Report.Location, Entry->RewardKey);
+	}
+
+	if (!LastItem) return;
+
+	if (GEngine)
+	{
+		GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::Orange,
+			FString::Printf(TEXT("Chaos +%.0f x%d  (%.0f / %.0f)"), BatchValue, Reports.Num(), TotalChaosScore, ChaosThreshold));
+	}
+
+	CommitChaosScore(LastItem, LastLocation);
+}
+
+float ACatGameMode::RecordDestroyedItem(AActor* Item, const FCatDestructibleEntry* Entry, const FVector& Location, FName ChaosRewardKey)
+{
+	// Registered props carry their key already — covers Blueprint callers that pass None.
+	if (ChaosRewardKey.IsNone() && Entry)
+	{
+		ChaosRewardKey = Entry->RewardKey;
+	}
+
+	// Resolve the reward row — the item component's cached row when the key matches,
+	// else a table lookup. Missing row falls back to DefaultChaosValue.
 	float Value = DefaultChaosValue;
 	FString ItemName = ChaosRewardKey.ToString();
 
-	if (ChaosRewardTable && !ChaosRewardKey.IsNone())
+	const UCatChaosItemComponent* ItemComp = Entry ? Entry->Item.Get() : nullptr;
+	const FChaosRewardData* Row = (ItemComp && ItemComp->ChaosRewardKey == ChaosRewardKey)
+		? ItemComp->GetRewardData() : nullptr;
+
+	if (!Row && ChaosRewardTable && !ChaosRewardKey.IsNone())
 	{
-		if (const FChaosRewardData* Row = ChaosRewardTable->FindRow<FChaosRewardData>(
-				ChaosRewardKey, TEXT("ReportItemDestroyed")))
-		{
-			Value = Row->ChaosValue;
-			if (!Row->DisplayName.IsEmpty()) ItemName = Row->DisplayName.ToString();
-		}
+		Row = ChaosRewardTable->FindRow<FChaosRewardData>(ChaosRewardKey, TEXT("ReportItemDestroyed"));
+	}
+
+	if (Row)
+	{
+		Value = Row->ChaosValue;
+		if (!Row->DisplayName.IsEmpty()) ItemName = Row->DisplayName.ToString();
 	}
 
 	// Record the destruction.
@@ -43,30 +147,163 @@ void ACatGameMode::ReportItemDestroyed(AActor* Item, FVector Location, FName Cha
 	Record.Value    = Value;
 	Record.ItemName = ItemName;
 	DestroyedItems.Add(Record);
+	UpdateTopValueSites(Item, Value);
+
+	// Budget ranking keeps valuable debris longest. Server-side only — clients rank
+	// unreported GCs as value 0 and still protect TopValueSites. Hero props play a recorded
+	// cache whose fragments the budget must not freeze or cull, so they are never tracked.
+	UCatDebrisSubsystem* Debris = UCatDebrisSubsystem::Get(this);
+	if (Debris && Entry && !Entry->Hero.IsValid())
+	{
+		Debris->SetCollectionValue(Entry->GCC.Get(), Value);
+	}
 
-	// Accumulate score and push to GameState for HUD replication.
 	TotalChaosScore += Value;
+	return Value;
+}
 
+void ACatGameMode::CommitChaosScore(AActor* LastItem, const FVector& LastLocation)
+{
+	// Push to GameState for HUD replication.
 	if (ACatGameState* GS = GetGameState<ACatGameState>())
 	{
 		GS->ChaosScore = TotalChaosScore;
 	}
 
-	if (GEngine)
-	{
-		GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::Orange,
-			FString::Printf(TEXT("Chaos +%.0f  (%.0f / %.0f)"), Value, TotalChaosScore, ChaosThreshold));
-	}
-
 	// Threshold check.
 	if (TotalChaosScore >= ChaosThreshold)
 	{
-		FinalBreakLocation = Location;
-		FinalBreakActor = Item;
+		FinalBreakLocation = LastLocation;
+		FinalBreakActor = LastItem;
 		BeginMatchEnd();
 	}
 }
 
+void ACatGameMode::UpdateTopValueSites(AActor* Item, float Value)
+{
+	if (!Item || ProtectedSiteCount <= 0) return;
+
+	const int32 InsertAt = TopValueItems.IndexOfByPredicate([Value](const TPair<TWeakObjectPtr<AActor>, float>& Entry)
+	{
+		return Value > Entry.Value;
+	});
+
+	if (InsertAt == INDEX_NONE)
+	{
+		if (TopValueItems.Num() >= ProtectedSiteCount) return;
+		TopValueItems.Emplace(Item, Value);
+	}
+	else
+	{
+		TopValueItems.Insert(TPair<TWeakObjectPtr<AActor>, float>(Item, Value), InsertAt);
+		TopValueItems.SetNum(FMath::Min(TopValueItems.Num(), ProtectedSiteCount));
+	}
+
+	if (ACatGameState* GS = GetGameState<ACatGameState>())
+	{
+		GS->TopValueSites.Reset();
+		for (const TPair<TWeakObjectPtr<AActor>, float>& Entry : TopValueItems)
+		{
+			GS->TopValueSites.Add(Entry.Key.Get());
+		}
+	}
+}
+
+// ── Rematch ─────────────────────────────────────────────────────────
+
+void ACatGameMode::HandleLevelAdded(ULevel* Level, UWorld* InWorld)
+{
+	if (InWorld == GetWorld())
+	{
+		CapturePropRestPoses(Level);
+	}
+}
+
+void ACatGameMode::CapturePropRestPoses(const ULevel* Level)
+{
+	if (!Level) return;
+
+	for (const AActor* Actor : Level->Actors)
+	{
+		if (!Actor || Actor->IsA<APawn>()) continue;
+
+		Actor->ForEachComponent<UPrimitiveComponent>(false, [this](UPrimitiveComponent* Prim)
+		{
+			// GCs rebuild from their rest collection instead.
+			if (!Prim->IsSimulatingPhysics() || Prim->IsA<UGeometryCollectionComponent>()) return;
+			PropRestPoses.Add(Prim, Prim->GetComponentTransform());
+		});
+	}
+}
+
+void ACatGameMode::ResetPropPoses()
+{
+	for (auto It = PropRestPoses.CreateIterator(); It; ++It)
+	{
+		UPrimitiveComponent* Prim = It.Key().Get();
+		if (!Prim)
+		{
+			// Streamed out — the cell reloads pristine and re-captures on arrival.
+			It.RemoveCurrent();
+			continue;
+		}
+
+		// An owner-simulated grab switches gravity off on the server's copy; put back what
+		// the prop was authored with.
+		if (const UPrimitiveComponent* Archetype = Cast<UPrimitiveComponent>(Prim->GetArchetype()))
+		{
+			Prim->SetEnableGravity(Archetype->BodyInstance.bEnableGravity);
+		}
+
+		Prim->SetWorldTransform(It.Value(), /*bSweep=*/false, nullptr, ETeleportType::ResetPhysics);
+		Prim->SetPhysicsLinearVelocity(FVector::ZeroVector);
+		Prim->SetPhysicsAngularVelocityInDegrees(FVector::ZeroVector);
+		Prim->PutRigidBodyToSleep();
+	}
+}
+
+void ACatGameMode::ResetMatchInPlace()
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	GetWorldTimerManager().ClearTimer(PhaseTimerHandle);
+	UGameplayStatics::SetGlobalTimeDilation(this, 1.0f);
+
+	CurrentPhase = ECatMatchPhase::Playing;
+	TotalChaosScore = 0.0f;
+	DestroyedItems.Reset();
+	TopValueItems.Reset();
+	FinalBreakLocation = FVector::ZeroVector;
+	FinalBreakActor.Reset();
+
+	// Props first, so respawned cats land in a clean room.
+	ResetPropPoses();
+
+	if (ACatGameState* GS = GetGameState<ACatGameState>())
+	{
+		GS->ResetMatchState();
+		GS->Multicast_ResetDestructibles();
+	}
+
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		APlayerController* PC = It->Get();
+		if (!PC) continue;
+
+		if (APawn* OldPawn = PC->GetPawn())
+		{
+			PC->UnPossess();
+			OldPawn->Destroy();
+		}
+		RestartPlayer(PC);
+	}
+
+	NotifyAllControllersPhaseChanged(ECatMatchPhase::Playing, nullptr);
+
+	UE_LOG(LogTemp, Log, TEXT("ACatGameMode::ResetMatchInPlace — %d props, %.1f ms"),
+		PropRestPoses.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
 // ── Phase 1: The Warning ────────────────────────────────────────────
 
 void ACatGameMode::BeginMatchEnd()
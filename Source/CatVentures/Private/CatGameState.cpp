@@ -1,8 +1,77 @@
 // CatGameState.cpp
 
 #include "CatGameState.h"
+#include "CatBase.h"
+#include "CatChaosItemComponent.h"
+#include "CatDebrisSubsystem.h"
+#include "CatHeroBreakComponent.h"
+#include "CatDestructibleSubsystem.h"
+#include "GeometryCollection/GeometryCollectionComponent.h"
+#include "GeometryCollection/Facades/CollectionDynamicStateFacade.h"
+#include "HAL/IConsoleManager.h"
 #include "Net/UnrealNetwork.h"
 
+// ── Console ─────────────────────────────────────────────────────────────
+
+static TAutoConsoleVariable<int32> CVarCatFractureMode(
+	TEXT("cat.Fracture.Mode"),
+	-1,
+	TEXT("Server: overrides ACatGameState::FractureMode. -1 = class default, 0 = Graded, 1 = Shatter. ")
+	TEXT("Clients follow the server's mode through replication; setting it on a client does nothing."),
+	ECVF_Cheat);
+
+static FAutoConsoleCommandWithWorld CmdCatFractureCountParticles(
+	TEXT("cat.Fracture.CountParticles"),
+	TEXT("Logs active rigid particles across every geometry collection in the world. ")
+	TEXT("Pair with 'stat ChaosThread' to compare Graded vs Shatter step time."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		int32 Collections = 0;
+		int32 ActiveParticles = 0;
+		int32 ActiveLeaves = 0;
+
+		const UCatDestructibleSubsystem* Registry = UCatDestructibleSubsystem::Get(World);
+		if (!Registry) return;
+
+		for (const TPair<uint32, FCatDestructibleEntry>& Pair : Registry->GetEntries())
+		{
+			UGeometryCollectionComponent* GCC = Pair.Value.GCC.Get();
+			FGeometryDynamicCollection* DynCollection = GCC ? GCC->GetDynamicCollection() : nullptr;
+			if (!DynCollection) continue;
+
+			++Collections;
+			FGeometryCollectionDynamicStateFacade StateFacade(*DynCollection);
+			const int32 NumTransforms = GCC->GetComponentSpaceTransforms3f().Num();
+			for (int32 i = 0; i < NumTransforms; ++i)
+			{
+				if (!StateFacade.IsActive(i)) continue;
+				++ActiveParticles;
+				if (!StateFacade.HasChildren(i)) ++ActiveLeaves;
+			}
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("cat.Fracture.CountParticles — GCs: %d | Active particles: %d (leaves: %d) | Mode: %s"),
+			Collections, ActiveParticles, ActiveLeaves,
+			ACatGameState::GetFractureMode(World) == ECatFractureMode::Graded ? TEXT("Graded") : TEXT("Shatter"));
+	}));
+
+ACatGameState::ACatGameState()
+{
+	// Tick only runs while fractures are queued or logged — see QueueFractureEvent.
+	// PostUpdateWork so every bumper overlap of the frame has been queued before the flush.
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
+	PrimaryActorTick.TickGroup = TG_PostUpdateWork;
+
+	FractureTunings.AddDefaulted();
+}
+
+void ACatGameState::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+	FractureLog.OwnerState = this;
+}
+
 void ACatGameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
@@ -12,7 +81,254 @@ void ACatGameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLif
 	DOREPLIFETIME(ACatGameState, ChaosThreshold);
 	DOREPLIFETIME(ACatGameState, FinalBreakLocation);
 	DOREPLIFETIME(ACatGameState, TopDestroyedLocations);
+	DOREPLIFETIME(ACatGameState, TopValueSites);
 	DOREPLIFETIME(ACatGameState, PlayerScores);
+	DOREPLIFETIME(ACatGameState, FractureLog);
+	DOREPLIFETIME(ACatGameState, FractureMode);
+}
+
+void ACatGameState::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	if (!HasAuthority())
+	{
+		SetActorTickEnabled(false);
+		return;
+	}
+
+	FlushPendingFractures();
+	ExpireFractureLog();
+
+	if (PendingFractures.IsEmpty() && FractureLog.Events.IsEmpty())
+	{
+		SetActorTickEnabled(false);
+	}
+}
+
+// ── Fracture Log ────────────────────────────────────────────────────
+
+const FCatFractureTuning& ACatGameState::GetFractureTuning(uint8 TuningIndex) const
+{
+	static const FCatFractureTuning Fallback;
+	if (FractureTunings.IsValidIndex(TuningIndex)) return FractureTunings[TuningIndex];
+	return FractureTunings.Num() > 0 ? FractureTunings[0] : Fallback;
+}
+
+void ACatGameState::QueueFractureEvent(uint32 DestructibleId, const FVector& Origin, uint8 TuningIndex, float Strain)
+{
+	if (!HasAuthority() || DestructibleId == UCatDestructibleSubsystem::InvalidId) return;
+
+	const FCatFractureTuning& Tuning = GetFractureTuning(TuningIndex);
+	const uint8 StrainFraction = Tuning.MaxStrain > 0.0f
+		? static_cast<uint8>(FMath::Clamp(FMath::RoundToInt(Strain / Tuning.MaxStrain * 255.0f), 0, 255))
+		: 0;
+
+	FCatFractureEvent* Existing = PendingFractures.Find(DestructibleId);
+	if (Existing)
+	{
+		// Same GC hit again this frame — keep the strongest contact.
+		const float ExistingStrain = GetFractureTuning(Existing->TuningIndex).MaxStrain * Existing->StrainFraction / 255.0f;
+		if (Strain > ExistingStrain)
+		{
+			Existing->Origin         = Origin;
+			Existing->TuningIndex    = TuningIndex;
+			Existing->StrainFraction = StrainFraction;
+		}
+		return;
+	}
+
+	FCatFractureEvent& Event = PendingFractures.Add(DestructibleId);
+	Event.DestructibleId = DestructibleId;
+	Event.Origin         = Origin;
+	Event.TuningIndex    = TuningIndex;
+	Event.StrainFraction = StrainFraction;
+
+	SetActorTickEnabled(true);
+}
+
+void ACatGameState::FlushPendingFractures()
+{
+	if (PendingFractures.IsEmpty()) return;
+
+	// Before logging, so a mode change replicates alongside the entries that use it.
+	UpdateFractureMode();
+
+	const float Now = GetWorld()->GetTimeSeconds();
+	const UCatDestructibleSubsystem* Registry = UCatDestructibleSubsystem::Get(this);
+
+	for (TPair<uint32, FCatFractureEvent>& Pair : PendingFractures)
+	{
+		const FCatDestructibleEntry* Entry = Registry ? Registry->Find(Pair.Key) : nullptr;
+		if (!Entry) continue;
+
+		FCatFractureEvent& Event = Pair.Value;
+		Event.LoggedTime = Now;
+		Event.Sequence   = ++LastFractureSequence;
+
+		// Hero props: pick the recording here so every peer plays the same one.
+		if (const UCatHeroBreakComponent* Hero = Entry->Hero.Get())
+		{
+			Event.HeroVariant = Hero->SelectVariant(Event.Origin);
+		}
+
+		// Hits on a GC with nothing left to break change nothing — keep them out of the snapshot.
+		const bool bWasShattered = Entry->bShattered;
+
+		// The server never receives its own replication — apply here for the host's solver.
+		ApplyFractureEvent(Event);
+
+		FCatFractureEvent& Logged = FractureLog.Events.Add_GetRef(Event);
+		FractureLog.MarkItemDirty(Logged);
+
+		// Late joiners replay the GC's merged damage.
+		if (!bWasShattered)
+		{
+			int32& Index = SnapshotIndexById.FindOrAdd(Event.DestructibleId, INDEX_NONE);
+			if (Index == INDEX_NONE)
+			{
+				Index = DestructionSnapshot.Num();
+				DestructionSnapshot.AddDefaulted_GetRef().DestructibleId = Event.DestructibleId;
+			}
+
+			FCatDestroyedGC& Destroyed = DestructionSnapshot[Index];
+			Destroyed.HeroVariant = Event.HeroVariant;
+			Destroyed.bShattered  = Registry->IsShattered(Event.DestructibleId);
+			Destroyed.AddHit(Event.Origin, Event.TuningIndex, Event.StrainFraction);
+		}
+	}
+
+	PendingFractures.Reset();
+}
+
+void ACatGameState::ExpireFractureLog()
+{
+	const float Cutoff = GetWorld()->GetTimeSeconds() - FractureLogLifetime;
+
+	int32 Removed = FractureLog.Events.RemoveAll([Cutoff](const FCatFractureEvent& Event)
+	{
+		return Event.LoggedTime < Cutoff;
+	});
+
+	// Entries are appended in log order, so the overflow is at the front.
+	const int32 Overflow = FractureLog.Events.Num() - MaxFractureLogEntries;
+	if (Overflow > 0)
+	{
+		FractureLog.Events.RemoveAt(0, Overflow);
+		Removed += Overflow;
+	}
+
+	if (Removed > 0)
+	{
+		FractureLog.MarkArrayDirty();
+	}
+}
+
+void ACatGameState::ApplyFractureEvent(const FCatFractureEvent& Event, bool bPlayEffects) const
+{
+	const UCatDestructibleSubsystem* Registry = UCatDestructibleSubsystem::Get(this);
+	const FCatDestructibleEntry* Entry = Registry ? Registry->Find(Event.DestructibleId) : nullptr;
+	if (UCatChaosItemComponent* Item = Entry ? Entry->Item.Get() : nullptr)
+	{
+		Item->NotifyFractured(Event.Origin, bPlayEffects);
+	}
+
+	if (Event.bForceShatter
+		|| Event.HeroVariant != FCatFractureEvent::NoHeroVariant
+		|| GetFractureMode(this) == ECatFractureMode::Shatter)
+	{
+		ApplyFracture(this, Event.DestructibleId, Event.Origin, Event.HeroVariant);
+		return;
+	}
+
+	const FCatFractureTuning& Tuning = GetFractureTuning(Event.TuningIndex);
+	ACatBase::ApplyGradedFracture(Entry ? Entry->GCC.Get() : nullptr,
+		Event.Origin, Tuning.Radius, Tuning.MaxStrain * Event.StrainFraction / 255.0f);
+}
+
+void ACatGameState::UpdateFractureMode()
+{
+	const int32 Override = CVarCatFractureMode.GetValueOnGameThread();
+	FractureMode = Override >= 0
+		? (Override == 0 ? ECatFractureMode::Graded : ECatFractureMode::Shatter)
+		: GetClass()->GetDefaultObject<ACatGameState>()->FractureMode;
+}
+
+ECatFractureMode ACatGameState::GetFractureMode(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	const ACatGameState* GS = World ? World->GetGameState<ACatGameState>() : nullptr;
+	return GS ? GS->FractureMode : GetDefault<ACatGameState>()->FractureMode;
+}
+
+void ACatGameState::ApplyFracture(const UObject* WorldContextObject, uint32 DestructibleId, const FVector& Origin,
+	uint8 HeroVariant)
+{
+	UCatDestructibleSubsystem* Registry = UCatDestructibleSubsystem::Get(WorldContextObject);
+	const FCatDestructibleEntry* Entry = Registry ? Registry->Find(DestructibleId) : nullptr;
+	if (!Entry) return;
+
+	Registry->MarkShattered(DestructibleId);
+
+	// Recorded playback replaces the live simulation entirely. A variant that can't play
+	// (cache manager missing on this peer) falls back to the live shatter.
+	if (HeroVariant != FCatFractureEvent::NoHeroVariant)
+	{
+		UCatHeroBreakComponent* Hero = Entry->Hero.Get();
+		if (Hero && Hero->PlayVariant(HeroVariant)) return;
+	}
+
+	ACatBase::ForceShatterGC(Entry->GCC.Get(), Origin);
+}
+
+void FCatFractureEvent::PostReplicatedAdd(const FCatFractureLog& InArraySerializer)
+{
+	const ACatGameState* OwnerState = InArraySerializer.OwnerState;
+
+	// An ID that isn't registered on this client (its level is streamed out) is held by the
+	// registry and applied when the cell streams in.
+	UCatDestructibleSubsystem* Registry = UCatDestructibleSubsystem::Get(OwnerState);
+	if (!Registry || Registry->IsCoveredBySnapshot(Sequence)) return;
+
+	// Entries in the GameState's initial state are history to a joiner — no effects.
+	Registry->ApplyOrDeferFracture(*this, /*bPlayEffects=*/OwnerState->HasActorBegunPlay());
+}
+
+void FCatDestroyedGC::AddHit(const FVector& Origin, uint8 TuningIndex, uint8 StrainFraction)
+{
+	// A shatter replays from one origin; older hits add nothing.
+	if (bShattered)
+	{
+		Hits.Reset();
+	}
+
+	if (Hits.Num() < MaxHits)
+	{
+		FCatSnapshotHit& Hit = Hits.AddDefaulted_GetRef();
+		Hit.Origin         = Origin;
+		Hit.TuningIndex    = TuningIndex;
+		Hit.StrainFraction = StrainFraction;
+		return;
+	}
+
+	FCatSnapshotHit* Nearest = nullptr;
+	float NearestDistSq = TNumericLimits<float>::Max();
+	for (FCatSnapshotHit& Hit : Hits)
+	{
+		const float DistSq = FVector::DistSquared(Hit.Origin, Origin);
+		if (DistSq < NearestDistSq)
+		{
+			NearestDistSq = DistSq;
+			Nearest = &Hit;
+		}
+	}
+
+	if (StrainFraction > Nearest->StrainFraction)
+	{
+		Nearest->Origin         = Origin;
+		Nearest->TuningIndex    = TuningIndex;
+		Nearest->StrainFraction = StrainFraction;
+	}
 }
 
 float ACatGameState::GetChaosPercent() const
@@ -21,6 +337,42 @@ float ACatGameState::GetChaosPercent() const
 	return FMath::Clamp(ChaosScore / ChaosThreshold, 0.0f, 1.0f);
 }
 
+// ── Rematch ─────────────────────────────────────────────────────────
+
+void ACatGameState::ResetMatchState()
+{
+	MatchPhase = ECatMatchPhase::Playing;
+	ChaosScore = 0.0f;
+	FinalBreakLocation = FVector::ZeroVector;
+	TopDestroyedLocations.Reset();
+	TopValueSites.Reset();
+
+	for (FCatPlayerScore& Entry : PlayerScores)
+	{
+		Entry.Score = 0;
+		Entry.ItemsDestroyed = 0;
+	}
+
+	PendingFractures.Reset();
+	FractureLog.Events.Reset();
+	FractureLog.MarkArrayDirty();
+	DestructionSnapshot.Reset();
+	SnapshotIndexById.Reset();
+}
+
+void ACatGameState::Multicast_ResetDestructibles_Implementation()
+{
+	if (UCatDebrisSubsystem* Debris = UCatDebrisSubsystem::Get(this))
+	{
+		Debris->Reset();
+	}
+
+	if (UCatDestructibleSubsystem* Registry = UCatDestructibleSubsystem::Get(this))
+	{
+		Registry->ResetDestructibles();
+	}
+}
+
 void ACatGameState::OnRep_MatchPhase()
 {
 	OnMatchPhaseChanged.Broadcast(MatchPhase);
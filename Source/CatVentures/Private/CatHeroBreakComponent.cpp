@@ -0,0 +1,63 @@
+// CatHeroBreakComponent.cpp
+
+#include "CatHeroBreakComponent.h"
+#include "CatDestructionTypes.h"
+#include "Chaos/CacheManagerActor.h"
+
+UCatHeroBreakComponent::UCatHeroBreakComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+uint8 UCatHeroBreakComponent::SelectVariant(const FVector& WorldHitLocation) const
+{
+	const AActor* Owner = GetOwner();
+	if (!Owner || Variants.IsEmpty()) return FCatFractureEvent::NoHeroVariant;
+
+	const FVector LocalHitDir = Owner->GetActorTransform()
+		.InverseTransformVectorNoScale(WorldHitLocation - Owner->GetActorLocation())
+		.GetSafeNormal();
+
+	int32 BestIndex = INDEX_NONE;
+	double BestDot = -UE_BIG_NUMBER;
+
+	const int32 NumVariants = FMath::Min(Variants.Num(), static_cast<int32>(FCatFractureEvent::NoHeroVariant));
+	for (int32 i = 0; i < NumVariants; ++i)
+	{
+		if (!Variants[i].CacheManager) continue;
+
+		const double Dot = FVector::DotProduct(LocalHitDir, Variants[i].HitDirection.GetSafeNormal());
+		if (Dot > BestDot)
+		{
+			BestDot = Dot;
+			BestIndex = i;
+		}
+	}
+
+	return BestIndex == INDEX_NONE ? FCatFractureEvent::NoHeroVariant : static_cast<uint8>(BestIndex);
+}
+
+bool UCatHeroBreakComponent::PlayVariant(uint8 VariantIndex)
+{
+	if (bHasPlayed) return true;
+	if (!Variants.IsValidIndex(VariantIndex)) return false;
+
+	AChaosCacheManager* Manager = Variants[VariantIndex].CacheManager;
+	if (!Manager) return false;
+
+	Manager->TriggerAll();
+	bHasPlayed = true;
+	return true;
+}
+
+void UCatHeroBreakComponent::ResetBreak()
+{
+	for (const FCatHeroBreakVariant& Variant : Variants)
+	{
+		if (Variant.CacheManager)
+		{
+			Variant.CacheManager->ResetAllComponentTransforms();
+		}
+	}
+	bHasPlayed = false;
+}
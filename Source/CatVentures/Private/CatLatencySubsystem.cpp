@@ -0,0 +1,217 @@
+// CatLatencySubsystem.cpp
+
+#include "CatLatencySubsystem.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/DateTime.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+// ── Console ─────────────────────────────────────────────────────────────
+
+static TAutoConsoleVariable<bool> CVarCatLatencyEnable(
+	TEXT("cat.Latency.Enable"),
+	false,
+	TEXT("Issue input-to-effect latency probes for Swat, Grab and Meow on the owning client."),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorldAndArgs CmdCatLatencyExport(
+	TEXT("cat.Latency.Export"),
+	TEXT("Writes latency percentiles to CSV. Optional arg: output path."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UCatLatencySubsystem* Latency = UCatLatencySubsystem::Get(World);
+		if (!Latency) return;
+
+		const FString Path = Args.Num() > 0
+			? Args[0]
+			: FPaths::ProfilingDir() / TEXT("CatLatency") /
+				FString::Printf(TEXT("Latency_%s.csv"), *FDateTime::Now().ToString());
+
+		Latency->ExportCsv(Path);
+	}));
+
+static FAutoConsoleCommandWithWorld CmdCatLatencyReset(
+	TEXT("cat.Latency.Reset"),
+	TEXT("Clears all latency histograms."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (UCatLatencySubsystem* Latency = UCatLatencySubsystem::Get(World))
+		{
+			Latency->ResetHistograms();
+		}
+	}));
+
+// ── Insights / CSV profiler channels ────────────────────────────────────
+// One counter per stage so Insights can plot each track separately.
+
+TRACE_DECLARE_FLOAT_COUNTER(CatLatency_SwatMontageStart, TEXT("CatLatency/SwatMontageStart (ms)"));
+TRACE_DECLARE_FLOAT_COUNTER(CatLatency_SwatServerAck,    TEXT("CatLatency/SwatServerAck (ms)"));
+TRACE_DECLARE_FLOAT_COUNTER(CatLatency_SwatServerHit,    TEXT("CatLatency/SwatServerHit (ms)"));
+TRACE_DECLARE_FLOAT_COUNTER(CatLatency_SwatImpulse,      TEXT("CatLatency/SwatImpulse (ms)"));
+TRACE_DECLARE_FLOAT_COUNTER(CatLatency_GrabServerAck,    TEXT("CatLatency/GrabServerAck (ms)"));
+TRACE_DECLARE_FLOAT_COUNTER(CatLatency_GrabConstraint,   TEXT("CatLatency/GrabConstraint (ms)"));
+TRACE_DECLARE_FLOAT_COUNTER(CatLatency_MeowBroadcast,    TEXT("CatLatency/MeowBroadcast (ms)"));
+
+CSV_DEFINE_CATEGORY(CatLatency, true);
+
+static void EmitLatencySample(ECatLatencyStage Stage, double Ms)
+{
+	switch (Stage)
+	{
+	case ECatLatencyStage::SwatMontageStart: TRACE_COUNTER_SET(CatLatency_SwatMontageStart, Ms); break;
+	case ECatLatencyStage::SwatServerAck:    TRACE_COUNTER_SET(CatLatency_SwatServerAck, Ms);    break;
+	case ECatLatencyStage::SwatServerHit:    TRACE_COUNTER_SET(CatLatency_SwatServerHit, Ms);    break;
+	case ECatLatencyStage::SwatImpulse:      TRACE_COUNTER_SET(CatLatency_SwatImpulse, Ms);      break;
+	case ECatLatencyStage::GrabServerAck:    TRACE_COUNTER_SET(CatLatency_GrabServerAck, Ms);    break;
+	case ECatLatencyStage::GrabConstraint:   TRACE_COUNTER_SET(CatLatency_GrabConstraint, Ms);   break;
+	case ECatLatencyStage::MeowBroadcast:    TRACE_COUNTER_SET(CatLatency_MeowBroadcast, Ms);    break;
+	default: break;
+	}
+
+#if CSV_PROFILER
+	const FName StatName(*StaticEnum<ECatLatencyStage>()->GetNameStringByValue(static_cast<int64>(Stage)));
+	FCsvProfiler::RecordCustomStat(StatName, CSV_CATEGORY_INDEX(CatLatency), Ms, ECsvCustomStatOp::Set);
+#endif
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// ── Histogram ───────────────────────────────────────────────────────────
+// ══════════════════════════════════════════════════════════════════════════
+
+void FCatLatencyHistogram::Add(double Ms)
+{
+	if (Buckets.Num() == 0)
+	{
+		Buckets.SetNumZeroed(MaxTrackedMs + 1);
+	}
+
+	const int32 Bucket = FMath::Clamp(FMath::FloorToInt32(Ms), 0, MaxTrackedMs);
+	++Buckets[Bucket];
+
+	++Count;
+	SumMs += Ms;
+	MaxMs = FMath::Max(MaxMs, Ms);
+}
+
+void FCatLatencyHistogram::Reset()
+{
+	Buckets.Reset();
+	Count = 0;
+	SumMs = 0.0;
+	MaxMs = 0.0;
+}
+
+double FCatLatencyHistogram::GetPercentile(double Percentile) const
+{
+	if (Count == 0) return 0.0;
+
+	// Nearest-rank: the smallest bucket whose cumulative count reaches the target rank.
+	const uint64 TargetRank = FMath::Max<uint64>(1, FMath::CeilToInt64(FMath::Clamp(Percentile, 0.0, 1.0) * Count));
+	uint64 Cumulative = 0;
+
+	for (int32 i = 0; i < Buckets.Num(); ++i)
+	{
+		Cumulative += Buckets[i];
+		if (Cumulative >= TargetRank)
+		{
+			// Overflow bucket has no upper edge — report the observed max instead.
+			return (i == MaxTrackedMs) ? MaxMs : static_cast<double>(i + 1);
+		}
+	}
+	return MaxMs;
+}
+
+// ══════════════════════════════════════════════════════════════════════════
+// ── Subsystem ───────────────────────────────────────────────────────────
+// ══════════════════════════════════════════════════════════════════════════
+
+UCatLatencySubsystem* UCatLatencySubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	const UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
+	return GI ? GI->GetSubsystem<UCatLatencySubsystem>() : nullptr;
+}
+
+bool UCatLatencySubsystem::IsEnabled()
+{
+	return CVarCatLatencyEnable.GetValueOnGameThread();
+}
+
+uint16 UCatLatencySubsystem::BeginProbe()
+{
+	if (!IsEnabled()) return 0;
+
+	const double Now = FPlatformTime::Seconds();
+	PruneStaleProbes(Now);
+
+	// 0 is reserved for "untracked" — skip it on wrap-around.
+	const uint16 ProbeId = NextProbeId;
+	NextProbeId = (NextProbeId == MAX_uint16) ? 1 : NextProbeId + 1;
+
+	PendingProbes.Add(ProbeId, Now);
+	return ProbeId;
+}
+
+void UCatLatencySubsystem::MarkStage(uint16 ProbeId, ECatLatencyStage Stage)
+{
+	if (ProbeId == 0 || Stage >= ECatLatencyStage::MAX) return;
+
+	const double* StartTime = PendingProbes.Find(ProbeId);
+	if (!StartTime) return;
+
+	const double Ms = (FPlatformTime::Seconds() - *StartTime) * 1000.0;
+	Histograms[static_cast<int32>(Stage)].Add(Ms);
+	EmitLatencySample(Stage, Ms);
+
+	UE_LOG(LogTemp, Verbose, TEXT("CatLatency — probe %u %s: %.2f ms"), ProbeId,
+		*StaticEnum<ECatLatencyStage>()->GetNameStringByValue(static_cast<int64>(Stage)), Ms);
+}
+
+void UCatLatencySubsystem::PruneStaleProbes(double Now)
+{
+	// Every tracked stage resolves well within a second on a playable connection;
+	// anything older than this lost its ack and would only skew the next reuse of its id.
+	constexpr double ProbeLifetimeSeconds = 5.0;
+
+	for (auto It = PendingProbes.CreateIterator(); It; ++It)
+	{
+		if (Now - It.Value() > ProbeLifetimeSeconds)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UCatLatencySubsystem::ResetHistograms()
+{
+	for (FCatLatencyHistogram& Histogram : Histograms)
+	{
+		Histogram.Reset();
+	}
+	PendingProbes.Reset();
+}
+
+bool UCatLatencySubsystem::ExportCsv(const FString& FilePath) const
+{
+	FString Csv = TEXT("Stage,Count,MeanMs,P50Ms,P90Ms,P99Ms,MaxMs\n");
+
+	for (int32 i = 0; i < static_cast<int32>(ECatLatencyStage::MAX); ++i)
+	{
+		const FCatLatencyHistogram& H = Histograms[i];
+		Csv += FString::Printf(TEXT("%s,%d,%.2f,%.2f,%.2f,%.2f,%.2f\n"),
+			*StaticEnum<ECatLatencyStage>()->GetNameStringByValue(i),
+			H.GetCount(), H.GetMeanMs(),
+			H.GetPercentile(0.50), H.GetPercentile(0.90), H.GetPercentile(0.99),
+			H.GetMaxMs());
+	}
+
+	const bool bSaved = FFileHelper::SaveStringToFile(Csv, *FilePath);
+	UE_LOG(LogTemp, Log, TEXT("UCatLatencySubsystem::ExportCsv — %s %s"),
+		bSaved ? TEXT("wrote") : TEXT("FAILED to write"), *FilePath);
+	return bSaved;
+}
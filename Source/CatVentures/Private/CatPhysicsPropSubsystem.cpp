@@ -0,0 +1,211 @@
+// CatPhysicsPropSubsystem.cpp
+
+#include "CatPhysicsPropSubsystem.h"
+#include "CatVentures.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "GeometryCollection/GeometryCollectionComponent.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Physics Props Tracked"), STAT_CatPhysicsProps, STATGROUP_CatVentures);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Prop Replication Corrections"), STAT_CatPropCorrections, STATGROUP_CatVentures);
+
+// ── Console ─────────────────────────────────────────────────────────────
+
+static TAutoConsoleVariable<int32> CVarCatPropReplicationMode(
+	TEXT("cat.Props.PhysicsReplicationMode"),
+	1,
+	TEXT("Physics replication mode for cat-pushable props. ")
+	TEXT("0 = Default (snap/correct, no client impulse prediction), 1 = PredictiveInterpolation."));
+
+static FAutoConsoleCommandWithWorld CmdCatPropsReportCorrections(
+	TEXT("cat.Props.ReportCorrections"),
+	TEXT("Client: logs server samples and corrections per replication mode. ")
+	TEXT("Switch cat.Props.PhysicsReplicationMode mid-session to fill both rows."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (const UCatPhysicsPropSubsystem* Props = UCatPhysicsPropSubsystem::Get(World))
+		{
+			Props->ReportCorrections();
+		}
+	}));
+
+static EPhysicsReplicationMode ToReplicationMode(int32 Mode)
+{
+	// Resimulation needs a network physics component per prop and the async physics tick — not offered.
+	return Mode == 1 ? EPhysicsReplicationMode::PredictiveInterpolation : EPhysicsReplicationMode::Default;
+}
+
+UCatPhysicsPropSubsystem* UCatPhysicsPropSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UCatPhysicsPropSubsystem>() : nullptr;
+}
+
+bool UCatPhysicsPropSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UCatPhysicsPropSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCatPhysicsPropSubsystem, STATGROUP_Tickables);
+}
+
+bool UCatPhysicsPropSubsystem::IsPredictedProp(const UPrimitiveComponent* Comp)
+{
+	const AActor* Owner = Comp ? Comp->GetOwner() : nullptr;
+	return Owner
+		&& Owner->IsReplicatingMovement()
+		&& Owner->GetPhysicsReplicationMode() == EPhysicsReplicationMode::PredictiveInterpolation;
+}
+
+void UCatPhysicsPropSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UCatPhysicsPropSubsystem::HandleLevelAdded);
+}
+
+void UCatPhysicsPropSubsystem::Deinitialize()
+{
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	Props.Reset();
+
+	Super::Deinitialize();
+}
+
+void UCatPhysicsPropSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	AppliedMode = CVarCatPropReplicationMode.GetValueOnGameThread();
+	for (ULevel* Level : InWorld.GetLevels())
+	{
+		RegisterLevel(Level);
+	}
+}
+
+void UCatPhysicsPropSubsystem::HandleLevelAdded(ULevel* Level, UWorld* InWorld)
+{
+	if (InWorld != GetWorld() || !InWorld->HasBegunPlay()) return;
+
+	RegisterLevel(Level);
+}
+
+void UCatPhysicsPropSubsystem::RegisterLevel(ULevel* Level)
+{
+	if (!Level) return;
+
+	const EPhysicsReplicationMode Mode = ToReplicationMode(AppliedMode);
+
+	for (AActor* Actor : Level->Actors)
+	{
+		if (!Actor || !Actor->IsReplicatingMovement()) continue;
+
+		UPrimitiveComponent* Root = Cast<UPrimitiveComponent>(Actor->GetRootComponent());
+		if (!Root || !Root->IsSimulatingPhysics() || Root->IsA<UGeometryCollectionComponent>()) continue;
+
+		Actor->SetPhysicsReplicationMode(Mode);
+
+		FTrackedProp& Prop = Props.AddDefaulted_GetRef();
+		Prop.Body               = Root;
+		Prop.LastServerLocation = Actor->GetReplicatedMovement().Location;
+		Prop.LastServerVelocity = Actor->GetReplicatedMovement().LinearVelocity;
+	}
+}
+
+void UCatPhysicsPropSubsystem::ApplyMode(int32 Mode)
+{
+	AppliedMode = Mode;
+
+	const EPhysicsReplicationMode ReplicationMode = ToReplicationMode(Mode);
+	for (const FTrackedProp& Prop : Props)
+	{
+		if (const UPrimitiveComponent* Body = Prop.Body.Get())
+		{
+			Body->GetOwner()->SetPhysicsReplicationMode(ReplicationMode);
+		}
+	}
+}
+
+void UCatPhysicsPropSubsystem::Tick(float DeltaTime)
+{
+	const int32 Mode = CVarCatPropReplicationMode.GetValueOnGameThread();
+	if (Mode != AppliedMode)
+	{
+		ApplyMode(Mode);
+	}
+
+	// Streamed-out or destroyed props.
+	Props.RemoveAllSwap([](const FTrackedProp& Prop) { return !Prop.Body.IsValid(); });
+	SET_DWORD_STAT(STAT_CatPhysicsProps, Props.Num());
+
+	if (GetWorld()->GetNetMode() == NM_Client)
+	{
+		CountCorrections(DeltaTime);
+	}
+}
+
+void UCatPhysicsPropSubsystem::CountCorrections(float DeltaTime)
+{
+	// ToReplicationMode treats anything but 1 as Default.
+	FCorrectionTally& Tally = Tallies[AppliedMode == 1 ? 1 : 0];
+
+	// Samples are a one-way trip old; the body has moved on by roughly that much since.
+	const APlayerController* PC = GetWorld()->GetFirstPlayerController();
+	const APlayerState* PS = PC ? PC->PlayerState : nullptr;
+	const float OneWaySeconds = PS ? PS->GetPingInMilliseconds() * 0.0005f : 0.0f;
+
+	const float ThresholdSq = FMath::Square(CorrectionDistance);
+	bool bAnyAwake = false;
+
+	for (FTrackedProp& Prop : Props)
+	{
+		const UPrimitiveComponent* Body = Prop.Body.Get();
+		const AActor* Owner = Body->GetOwner();
+
+		// A held prop's owner ignores replicated movement while it simulates the body itself.
+		const FRepMovement& Server = Owner->GetReplicatedMovement();
+		const bool bNewSample = !Server.Location.Equals(Prop.LastServerLocation, KINDA_SMALL_NUMBER)
+			|| !Server.LinearVelocity.Equals(Prop.LastServerVelocity, KINDA_SMALL_NUMBER);
+		Prop.LastServerLocation = Server.Location;
+		Prop.LastServerVelocity = Server.LinearVelocity;
+
+		if (!Owner->IsReplicatingMovement() || !Body->IsAnyRigidBodyAwake()) continue;
+		bAnyAwake = true;
+
+		if (!bNewSample) continue;
+		++Tally.Samples;
+
+		const FVector Expected = Server.Location + Server.LinearVelocity * OneWaySeconds;
+		if (FVector::DistSquared(Body->GetComponentLocation(), Expected) > ThresholdSq)
+		{
+			++Tally.Corrections;
+			INC_DWORD_STAT(STAT_CatPropCorrections);
+		}
+	}
+
+	if (bAnyAwake)
+	{
+		Tally.AwakeSeconds += DeltaTime;
+	}
+}
+
+void UCatPhysicsPropSubsystem::ReportCorrections() const
+{
+	static const TCHAR* ModeNames[] = { TEXT("Default"), TEXT("PredictiveInterpolation") };
+
+	UE_LOG(LogTemp, Log, TEXT("UCatPhysicsPropSubsystem::ReportCorrections — %d props tracked, correction distance %.1f cm"), Props.Num(), CorrectionDistance);
+	for (int32 Mode = 0; Mode < UE_ARRAY_COUNT(Tallies); ++Mode)
+	{
+		const FCorrectionTally& Tally = Tallies[Mode];
+		UE_LOG(LogTemp, Log, TEXT("  %-24s %6d samples  %6d corrections (%5.1f%%)  %.0f s with props awake"),
+			ModeNames[Mode], Tally.Samples, Tally.Corrections,
+			Tally.Samples > 0 ? 100.0 * Tally.Corrections / Tally.Samples : 0.0,
+			Tally.AwakeSeconds);
+	}
+}
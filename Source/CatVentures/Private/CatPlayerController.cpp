@@ -2,6 +2,8 @@
 
 #include "CatPlayerController.h"
 #include "CatBase.h"
+#include "CatGameState.h"
+#include "CatDestructibleSubsystem.h"
 #include "EnhancedInputComponent.h"
 #include "EnhancedInputSubsystems.h"
 #include "Blueprint/UserWidget.h"
@@ -66,12 +68,98 @@ void ACatPlayerController::ToggleMenu()
 	}
 }
 
+// ── Join In Progress ────────────────────────────────────────────────
+
+void ACatPlayerController::Client_ReceiveDestructionSnapshot_Implementation(const TArray<FCatDestroyedGC>& Chunk,
+	uint32 Sequence, bool bFirstChunk)
+{
+	const bool bSliceArmed = PendingSnapshotIndex < PendingSnapshot.Num();
+
+	// A second snapshot (reconnect without travel) supersedes any unfinished one.
+	if (bFirstChunk)
+	{
+		PendingSnapshot = Chunk;
+		PendingSnapshotIndex = 0;
+	}
+	else
+	{
+		PendingSnapshot.Append(Chunk);
+	}
+
+	// Fracture log entries up to Sequence are in the snapshot — don't apply them twice.
+	if (UCatDestructibleSubsystem* Registry = UCatDestructibleSubsystem::Get(this))
+	{
+		Registry->SetSnapshotSequence(Sequence);
+	}
+
+	if (!bSliceArmed)
+	{
+		GetWorldTimerManager().SetTimerForNextTick(this, &ACatPlayerController::ApplySnapshotSlice);
+	}
+}
+
+void ACatPlayerController::ApplySnapshotSlice()
+{
+	// No registry (a world type it doesn't run in) — nothing could ever apply, so drop it
+	// rather than re-arm every frame.
+	UCatDestructibleSubsystem* Registry = UCatDestructibleSubsystem::Get(this);
+	if (!Registry)
+	{
+		PendingSnapshot.Empty();
+		PendingSnapshotIndex = 0;
+		return;
+	}
+
+	const int32 End = FMath::Min(PendingSnapshotIndex + SnapshotFracturesPerFrame, PendingSnapshot.Num());
+
+	for (; PendingSnapshotIndex < End; ++PendingSnapshotIndex)
+	{
+		const FCatDestroyedGC& Entry = PendingSnapshot[PendingSnapshotIndex];
+		if (Entry.Hits.IsEmpty()) continue;
+
+		// Props in cells this client hasn't streamed in yet are held by the registry and
+		// broken when they register.
+		FCatFractureEvent Event;
+		Event.DestructibleId = Entry.DestructibleId;
+		Event.HeroVariant    = Entry.HeroVariant;
+
+		if (Entry.bShattered)
+		{
+			Event.Origin        = Entry.Hits.Last().Origin;
+			Event.bForceShatter = true;
+			Registry->ApplyOrDeferFracture(Event, /*bPlayEffects=*/false);
+			continue;
+		}
+
+		for (const FCatSnapshotHit& Hit : Entry.Hits)
+		{
+			Event.Origin         = Hit.Origin;
+			Event.TuningIndex    = Hit.TuningIndex;
+			Event.StrainFraction = Hit.StrainFraction;
+			Registry->ApplyOrDeferFracture(Event, /*bPlayEffects=*/false);
+		}
+	}
+
+	if (PendingSnapshotIndex < PendingSnapshot.Num())
+	{
+		GetWorldTimerManager().SetTimerForNextTick(this, &ACatPlayerController::ApplySnapshotSlice);
+		return;
+	}
+
+	PendingSnapshot.Empty();
+	PendingSnapshotIndex = 0;
+}
+
 // ── Match Phase Orchestration ───────────────────────────────────────
 
 void ACatPlayerController::Client_OnMatchPhaseChanged_Implementation(ECatMatchPhase NewPhase, FVector PhaseLocation, AActor* TargetActor)
 {
 	switch (NewPhase)
 	{
+	case ECatMatchPhase::Playing:
+		HandlePhase_Playing();
+		break;
+
 	case ECatMatchPhase::Warning:
 		HandlePhase_Warning();
 		break;
@@ -93,6 +181,34 @@ void ACatPlayerController::Client_OnMatchPhaseChanged_Implementation(ECatMatchPh
 	}
 }
 
+void ACatPlayerController::HandlePhase_Playing()
+{
+	// Rematch. The respawned cat adds its own DefaultMappingContext; drop the
+	// look-only context Phase 1 swapped in, and any catch-up from the old match.
+	if (UEnhancedInputLocalPlayerSubsystem* Subsystem =
+		ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(GetLocalPlayer()))
+	{
+		if (LookOnlyMappingContext)
+		{
+			Subsystem->RemoveMappingContext(LookOnlyMappingContext);
+		}
+	}
+
+	PendingSnapshot.Reset();
+	PendingSnapshotIndex = 0;
+
+	bShowMouseCursor = false;
+	SetInputMode(FInputModeGameOnly());
+
+	OnMatchRestarted();
+
+	if (GEngine)
+	{
+		GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Green,
+			TEXT("REMATCH — props reset, cats respawned"));
+	}
+}
+
 void ACatPlayerController::HandlePhase_Warning()
 {
 	// Swap mapping contexts: strip movement, keep camera look.
@@ -160,7 +276,11 @@ FVector ACatPlayerController::GetChaosTargetLocation(AActor* TargetActor) const
 {
 	if (!TargetActor) return FVector::ZeroVector;
 
-	UGeometryCollectionComponent* GCComp = TargetActor->FindComponentByClass<UGeometryCollectionComponent>();
+	const UCatDestructibleSubsystem* Registry = UCatDestructibleSubsystem::Get(this);
+	const FCatDestructibleEntry* Entry = Registry ? Registry->FindByActor(TargetActor) : nullptr;
+	UGeometryCollectionComponent* GCComp = Entry
+		? Entry->GCC.Get()
+		: TargetActor->FindComponentByClass<UGeometryCollectionComponent>();
 	if (!GCComp) return TargetActor->GetActorLocation();
 
 	FGeometryDynamicCollection* DynCollection = GCComp->GetDynamicCollection();
@@ -0,0 +1,126 @@
+// CatAsyncPhysicsSubsystem.h — Fixed-step physics-thread callback for cat pushes and grab reach.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CatAsyncPhysicsSubsystem.generated.h"
+
+class ACatBase;
+class UPrimitiveComponent;
+class FCatAsyncPhysicsCallback;
+
+namespace Chaos
+{
+	class FSingleParticlePhysicsProxy;
+}
+
+/** A body as handed to the physics thread. Proxy is captured from a live component at
+ *  handover and only ever reached through its physics-thread handle, which Chaos clears
+ *  once the particle is unregistered. */
+struct FCatAsyncParticleRef
+{
+	Chaos::FSingleParticlePhysicsProxy* Proxy = nullptr;
+};
+
+/** One cat's state for the physics thread, rebuilt by the cat every frame it needs the callback. */
+struct FCatAsyncCatInput
+{
+	/** Grab reach check — skipped while HeldBody is unset. Game thread only; the subsystem
+	 *  resolves it to Held when it hands the frame over. */
+	TWeakObjectPtr<const UPrimitiveComponent> HeldBody;
+	FCatAsyncParticleRef Held;
+	FVector GrabTarget = FVector::ZeroVector;
+	float MaxGrabDistance = 0.0f;
+
+	/** FCatGrabState::Sequence the check belongs to, echoed back so a stale result can't drop a newer grab. */
+	uint8 GrabSequence = 0;
+};
+
+/** One cat's results from the most recent physics step. */
+struct FCatAsyncCatOutput
+{
+	bool bGrabOverreached = false;
+	uint8 GrabSequence = 0;
+};
+
+/**
+ * Per-world owner of the cats' async physics callback.
+ *
+ * Opt-in: the project ticks physics synchronously. With the async physics tick turned on
+ * (bTickPhysicsAsync under [/Script/Engine.PhysicsSettings]) and cat.Physics.AsyncCallbacks
+ * set, one Chaos sim callback runs before every fixed physics step and does the contact-driven
+ * work that otherwise runs at the variable frame rate:
+ *
+ *   - bumper push impulses, applied to the body's velocity on the physics thread
+ *   - the grab drive's reach check against MaxGrabDistance
+ *
+ * Cats never touch the callback directly. During their tick they queue impulses and edit
+ * their FCatAsyncCatInput here; Tick hands the whole frame's input over in one buffer and
+ * collects the latest outputs, which cats read next frame. Jump gravity stays with the
+ * character movement component on the game thread.
+ *
+ * Geometry collections have no single-particle proxy; their pushes keep the game-thread path.
+ * When the subsystem isn't active, every caller falls back to its game-thread code.
+ */
+UCLASS()
+class CATVENTURES_API UCatAsyncPhysicsSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor — returns nullptr without a world. */
+	static UCatAsyncPhysicsSubsystem* Get(const UObject* WorldContextObject);
+
+	/** The subsystem if the callback is registered and enabled, else nullptr. */
+	static UCatAsyncPhysicsSubsystem* GetActive(const UObject* WorldContextObject);
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	bool IsActive() const;
+
+	/** Queues Impulse (kg·cm/s) on Body for the next physics step. False if Body has no
+	 *  single-particle proxy — the caller applies it on the game thread instead. */
+	bool QueueImpulse(const UPrimitiveComponent* Body, const FVector& Impulse);
+
+	/** This frame's input for Cat. Fields not written this frame keep their defaults. */
+	FCatAsyncCatInput& EditCatInput(const ACatBase* Cat);
+
+	/** Cat's most recent physics-step results, or nullptr before the first step. */
+	const FCatAsyncCatOutput* FindCatOutput(const ACatBase* Cat) const;
+
+	/** Drops Cat's physics-thread state. */
+	void RemoveCat(const ACatBase* Cat);
+
+	/** Proxy of Body's single rigid particle, or nullptr (GCs, unregistered or deleted bodies). */
+	static Chaos::FSingleParticlePhysicsProxy* GetSingleParticleProxy(const UPrimitiveComponent* Body);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FQueuedImpulse
+	{
+		TWeakObjectPtr<const UPrimitiveComponent> Body;
+		FVector Impulse = FVector::ZeroVector;
+	};
+
+	/** Owned by the solver; freed through it in Deinitialize. */
+	FCatAsyncPhysicsCallback* Callback = nullptr;
+
+	// ── Game-thread buffers, handed over once per frame ─────────────
+
+	TArray<FQueuedImpulse> PendingImpulses;
+	TMap<uint32, FCatAsyncCatInput> PendingCats;
+	TArray<uint32> PendingRemovals;
+
+	/** Stamped on each handed-over input so the callback applies its impulses exactly once. */
+	uint32 InputSerial = 0;
+
+	TMap<uint32, FCatAsyncCatOutput> LatestOutputs;
+
+	static uint32 GetCatKey(const ACatBase* Cat);
+};
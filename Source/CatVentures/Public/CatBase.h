@@ -4,7 +4,10 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
+#include "Engine/NetSerialization.h"
+#include "WorldCollision.h"
 #include "CatAnimationTypes.h"
+#include "CatLatencySubsystem.h"
 #include "CatBase.generated.h"
 
 class UInputMappingContext;
@@ -16,11 +19,79 @@ class UAnimMontage;
 class UBoxComponent;
 class UPhysicsConstraintComponent;
 class UGeometryCollectionComponent;
+class UCatFootIKComponent;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnMeowDelegate);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnSwatHitDelegate, AActor*, HitActor, FVector, HitLocation);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnJumpPhaseChanged, ECatJumpPhase, NewPhase);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnCatLanded, float, ImpactIntensity, float, AirTime);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnGrabCandidateChanged, UPrimitiveComponent*, Candidate);
+
+/** Root-only ragdoll state. The server samples the pelvis body at RagdollNetUpdateRate and
+ *  replicates just this; every client simulates the physics asset locally and steers its own
+ *  pelvis toward it. Location/velocity at 0.1 cm, rotation as compressed shorts (~20 bytes). */
+USTRUCT()
+struct FCatRagdollRootState
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FVector_NetQuantize10 PelvisLocation;
+
+	UPROPERTY()
+	FRotator PelvisRotation = FRotator::ZeroRotator;
+
+	UPROPERTY()
+	FVector_NetQuantize10 PelvisVelocity;
+};
+
+/** Replicated mouth-grab state. Target travels as its net GUID; a null Target means idle.
+ *  Sequence bumps on every grab and release, so a regrab of the same body still reads as
+ *  a change and each machine rebinds its constraint. */
+USTRUCT()
+struct FCatGrabState
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<UPrimitiveComponent> Target;
+
+	/** Skeleton bone index on skinned targets; INDEX_NONE constrains the root body. */
+	UPROPERTY()
+	int16 BoneIndex = INDEX_NONE;
+
+	UPROPERTY()
+	uint8 Sequence = 0;
+
+	/** The holder's owning client simulates Target; everyone else follows its stream. */
+	UPROPERTY()
+	bool bOwnerSimulated = false;
+};
+
+/** Held-body state streamed by the owning client while bOwnerSimulated, and relayed by the
+ *  server to everyone else. Same quantization as FCatRagdollRootState, plus spin. */
+USTRUCT()
+struct FCatHeldBodyState
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FVector_NetQuantize10 Location;
+
+	UPROPERTY()
+	FRotator Rotation = FRotator::ZeroRotator;
+
+	UPROPERTY()
+	FVector_NetQuantize10 LinearVelocity;
+
+	/** Degrees per second. */
+	UPROPERTY()
+	FVector_NetQuantize10 AngularVelocity;
+
+	/** FCatGrabState::Sequence of the grab this sample belongs to — stale samples are dropped. */
+	UPROPERTY()
+	uint8 GrabSequence = 0;
+};
 
 /**
  * Base C++ Character for all Cat pawns.
@@ -32,6 +103,10 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnCatLanded, float, ImpactIntensit
  *    preventing the "frozen client" problem.
  *  - Server_Meow RPC → NetMulticast_Meow → OnMeow broadcast for networked meowing.
  *  - The Swat: local-predicted montage with server-authoritative active-frame sweep.
+ *  - Ragdoll: every machine simulates the physics asset; only the pelvis is replicated.
+ *  - Mouth grab: server-validated sweep; GrabState replicates and every machine binds
+ *    its own persistent GrabConstraint to match. A remote holder's client simulates held
+ *    rigid bodies and streams them; the server validates and relays the stream.
  */
 UCLASS()
 class CATVENTURES_API ACatBase : public ACharacter
@@ -62,6 +137,13 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Camera")
 	TObjectPtr<UCameraComponent> FollowCamera;
 
+	// ── Foot IK ─────────────────────────────────────────────────────────
+
+	/** Native paw placement — replaces the Blueprint CompBP_IK_ANX traces. The AnimBP
+	 *  reads FootIK->GetFootIKPose() from its thread-safe update. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Foot IK")
+	TObjectPtr<UCatFootIKComponent> FootIK;
+
 	// ── Camera Tuning ──────────────────────────────────────────────────
 
 	/** Sensitivity multiplier applied to mouse/stick look input. */
@@ -189,6 +271,41 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
 	TObjectPtr<UAnimMontage> SwatMontage;
 
+	// ── Ragdoll ──────────────────────────────────────────────────────────
+
+	/** Root body of the physics asset — the only bone whose state is replicated. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ragdoll")
+	FName RagdollPelvisBone = TEXT("pelvis");
+
+	/** Collision profile applied to the mesh while ragdolled. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ragdoll")
+	FName RagdollCollisionProfile = TEXT("Ragdoll");
+
+	/** How often (Hz) the server samples and replicates the pelvis state while ragdolled. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ragdoll", meta = (ClampMin = "1.0", ClampMax = "30.0"))
+	float RagdollNetUpdateRate = 10.0f;
+
+	/** Gain (1/s) of the velocity correction that pulls a client's pelvis toward the
+	 *  extrapolated server pelvis. Higher = tighter tracking, more visible tugging. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ragdoll", meta = (ClampMin = "0.0", ClampMax = "20.0"))
+	float RagdollCorrectionGain = 4.0f;
+
+	/** Pelvis error (cm) beyond which a client teleports its whole ragdoll instead of steering. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ragdoll", meta = (ClampMin = "10.0"))
+	float RagdollSnapDistance = 150.0f;
+
+	/** Knocks the cat into ragdoll for Duration seconds, then stands it back up at the pelvis. Authority only. */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "Ragdoll")
+	void Knockout(float Duration = 3.0f);
+
+	/** Kills the cat: sets bDied + BaseAction Dead and ragdolls permanently. Authority only. */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "Ragdoll")
+	void Die();
+
+	/** True while the physics asset is simulating (knockout or death). */
+	UFUNCTION(BlueprintPure, Category = "Ragdoll")
+	bool IsRagdolling() const { return bIsRagdoll; }
+
 	// ── Interaction ─────────────────────────────────────────────────────
 
 	/** How far forward (cm) the interaction sphere trace reaches. */
@@ -222,15 +339,30 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics Bumper", meta = (ClampMin = "0.0"))
 	float BumperChaosImpulse = 10000.0f;
 
-	/** Radius (cm) of the radial impulse sphere emitted at the bumper contact point. */
+	/** Seconds after a bumper contact during which the same component is ignored.
+	 *  Suppresses overlap storms from shattering GCs and tumbling stacks. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics Bumper", meta = (ClampMin = "0.0"))
+	float BumperContactCooldown = 0.25f;
+
+	/** Row in ACatGameState::FractureTunings for this cat's GC hits — supplies the strain
+	 *  footprint radius and the scale strain is quantized against. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics Bumper")
+	uint8 BumperFractureTuning = 0;
+
+	/** Horizontal speed (cm/s) at which a bumper contact injects exactly BumperChaosImpulse.
+	 *  Slower contacts scale the strain down linearly, faster ones up to BumperMaxStrainScale. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics Bumper", meta = (ClampMin = "1.0"))
+	float BumperStrainReferenceSpeed = 600.0f;
+
+	/** Upper clamp on the speed multiplier applied to BumperChaosImpulse. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics Bumper", meta = (ClampMin = "1.0"))
-	float BumperDamageRadius = 200.0f;
+	float BumperMaxStrainScale = 3.0f;
 
 	// ── Mouth Grab ───────────────────────────────────────────────────────
 
-	/** Dynamically created physics constraint linking the mouth socket anchor to the
-	 *  grabbed body. Created on grab, destroyed on release. nullptr when idle. */
-	UPROPERTY()
+	/** Persistent physics constraint linking the mouth socket anchor to the grabbed body.
+	 *  Configured once at BeginPlay; grab binds it to the target, release unbinds it. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Mouth Grab")
 	TObjectPtr<UPhysicsConstraintComponent> GrabConstraint;
 
 	/** World-space follow point for the grab handle. Attached to socket_mouth so it
@@ -246,6 +378,15 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mouth Grab", meta = (ClampMin = "10.0"))
 	float GrabTraceLength = 175.0f;
 
+	/** How often (Hz) the owning client sweeps for the grab candidate it will send with Server_Grab. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mouth Grab", meta = (ClampMin = "1.0", ClampMax = "30.0"))
+	float GrabCandidateQueryRate = 10.0f;
+
+	/** Extra reach (cm) the server grants a client's candidate over GrabTraceLength + GrabTraceRadius,
+	 *  covering where the mouth was a round trip ago. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mouth Grab", meta = (ClampMin = "0.0"))
+	float GrabCandidateReachSlack = 60.0f;
+
 	/** Auto-release distance (cm). If the grabbed object's centre drifts further
 	 *  than this from GrabTargetLocation, the grab is dropped. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mouth Grab", meta = (ClampMin = "50.0"))
@@ -273,6 +414,35 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mouth Grab", meta = (ClampMin = "0.0"))
 	float GrabConstraintMaxForce = 100000.0f;
 
+	/** Send rate (Hz) of owner-simulated held-body state when the body is nearly still. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mouth Grab", meta = (ClampMin = "1.0", ClampMax = "60.0"))
+	float HeldBodyMinSendRate = 10.0f;
+
+	/** Send rate (Hz) once the held body moves at HeldBodySendReferenceSpeed or faster. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mouth Grab", meta = (ClampMin = "1.0", ClampMax = "60.0"))
+	float HeldBodyMaxSendRate = 30.0f;
+
+	/** Held-body speed (cm/s) at which the send rate reaches HeldBodyMaxSendRate. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mouth Grab", meta = (ClampMin = "1.0"))
+	float HeldBodySendReferenceSpeed = 400.0f;
+
+	/** Gain (1/s) pulling a follower's copy of the held body toward the extrapolated stream. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mouth Grab", meta = (ClampMin = "0.0", ClampMax = "20.0"))
+	float HeldBodyCorrectionGain = 6.0f;
+
+	/** Held-body error (cm) beyond which a follower teleports instead of steering. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mouth Grab", meta = (ClampMin = "10.0"))
+	float HeldBodySnapDistance = 100.0f;
+
+	/** Owning client: the body a grab would take right now changed (nullptr = nothing in reach,
+	 *  or a grab is active). Bind to drive highlight outlines. */
+	UPROPERTY(BlueprintAssignable, Category = "Mouth Grab")
+	FOnGrabCandidateChanged OnGrabCandidateChanged;
+
+	/** Current grab candidate on the owning client. nullptr elsewhere. */
+	UFUNCTION(BlueprintPure, Category = "Mouth Grab")
+	UPrimitiveComponent* GetGrabCandidate() const { return GrabCandidate.Get(); }
+
 	/** Broadcast on authority when the swat hits a physics actor. */
 	UPROPERTY(BlueprintAssignable, Category = "Combat")
 	FOnSwatHitDelegate OnSwatHit;
@@ -289,10 +459,11 @@ public:
 
 	// ── Swat Trace Interface (called by UAnimNotifyState_SwatTrace) ──
 
-	/** Called by NotifyBegin — caches initial paw position and clears hit set (authority only). */
+	/** Called by NotifyBegin — caches initial paw position and clears hit set (authority + owning client). */
 	void BeginSwatTrace(USkeletalMeshComponent* MeshComp, FName SocketName);
 
-	/** Called by NotifyTick — performs sphere sweep from previous to current paw position (authority only). */
+	/** Called by NotifyTick — performs sphere sweep from previous to current paw position. Authority
+	 *  resolves hits; the owning client only predicts the impulse on predicted props. */
 	void ProcessSwatTraceTick(USkeletalMeshComponent* MeshComp, FName SocketName, float SweepRadius, float DeltaTime);
 
 	/** Called by NotifyEnd — clears the hit set. Does NOT reset bIsSwatting (that's handled by OnSwatMontageEnded). */
@@ -301,6 +472,7 @@ public:
 protected:
 	//~ Begin AActor Interface
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	//~ End AActor Interface
 
 	//~ Begin APawn Interface
@@ -364,6 +536,9 @@ protected:
 	/** Processes IA_Look (Axis2D) — applies yaw/pitch to the controller rotation. */
 	void Look(const FInputActionValue& Value);
 
+	/** Fires on IA_Meow Started — opens a latency probe and sends Server_Meow. */
+	void TriggerMeow();
+
 	/** Fires on IA_Swat Started — local prediction + Server RPC. */
 	void TriggerSwat();
 
@@ -378,19 +553,20 @@ protected:
 
 	// ── Networked Meow ──────────────────────────────────────────────────
 
-	/** Client → Server: request a meow. */
+	/** Client → Server: request a meow. ProbeId is 0 unless latency probing is enabled. */
 	UFUNCTION(Server, Reliable)
-	void Server_Meow();
+	void Server_Meow(uint16 ProbeId);
 
-	/** Server → All: replicate the meow to every machine. */
+	/** Server → All: replicate the meow to every machine. ProbeId comes back to the
+	 *  owning client so it closes the probe that meow opened, not a later one. */
 	UFUNCTION(NetMulticast, Reliable)
-	void NetMulticast_Meow();
+	void NetMulticast_Meow(uint16 ProbeId);
 
 	// ── Networked Swat ─────────────────────────────────────────────────
 
-	/** Client → Server: request a swat. */
+	/** Client → Server: request a swat. ProbeId is 0 unless latency probing is enabled. */
 	UFUNCTION(Server, Reliable)
-	void Server_Swat();
+	void Server_Swat(uint16 ProbeId);
 
 	/** Server → All: play swat montage on all machines (instigator skips — already predicted). */
 	UFUNCTION(NetMulticast, Unreliable)
@@ -402,31 +578,30 @@ protected:
 	UFUNCTION(Server, Reliable)
 	void Server_Interact();
 
-	/** Client → Server: initiate a mouth grab at the current mouth socket position. */
+	/** Client → Server: grab the client's cached candidate. The server only checks that
+	 *  it is grabbable and within reach of the mouth. */
 	UFUNCTION(Server, Reliable)
-	void Server_Grab();
+	void Server_Grab(uint16 ProbeId, UPrimitiveComponent* Candidate, int16 BoneIndex);
 
 	/** Client → Server: release the currently grabbed component. */
 	UFUNCTION(Server, Reliable)
 	void Server_ReleaseGrab();
 
-	/** Server → All: create the physics constraint on every machine's local Chaos solver. */
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_Grab(UPrimitiveComponent* GrabbedComp, FName BoneName);
+	/** Owning client → Server: the held body's state while GrabState.bOwnerSimulated.
+	 *  Unreliable — a newer sample always supersedes a lost one. */
+	UFUNCTION(Server, Unreliable)
+	void Server_UpdateHeldBodyState(const FCatHeldBodyState& State);
 
-	/** Server → All: destroy the constraint and re-enable strain on every machine. */
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_ReleaseGrab();
+	/** Authority: writes GrabState (nullptr Target = release) and applies it locally.
+	 *  Clients follow through OnRep_GrabState. */
+	void SetGrabState(UPrimitiveComponent* Target, int16 BoneIndex);
 
 	// ── Networked Physics Bumper (GC Fracture) ────────────────────────────
 
-	/** Locally-controlled client → Server: validate a GC bumper hit and multicast strain. */
+	/** Locally-controlled client → Server: validate a GC bumper hit and queue it on the
+	 *  GameState fracture log, which replicates the strain to every machine. */
 	UFUNCTION(Server, Reliable)
-	void Server_BumperHitGC(AActor* GCActor, FVector Origin);
-
-	/** Server → All: apply Chaos strain on every machine's local physics solver. */
-	UFUNCTION(NetMulticast, Unreliable)
-	void Multicast_BumperHitGC(AActor* GCActor, FVector Origin, float Radius, float Strain);
+	void Server_BumperHitGC(uint32 DestructibleId, FVector_NetQuantize10 Origin);
 
 	/** Deterministic GC fracture — wakes the Chaos solver and injects overwhelming strain
 	 *  to guarantee immediate cluster-bond breakage. Call from Blueprints on high-speed
@@ -434,6 +609,19 @@ protected:
 	UFUNCTION(BlueprintCallable, Category = "Chaos")
 	static void ForceShatterGC(UGeometryCollectionComponent* GCC, FVector HitLocation);
 
+	/** Proportional GC fracture — strains the nearest active cluster under the Radius
+	 *  footprint, propagating only as many levels down as Strain clears the asset's
+	 *  per-level Damage Threshold. A light brush breaks nothing; a sprint breaks deep. */
+	UFUNCTION(BlueprintCallable, Category = "Chaos")
+	static void ApplyGradedFracture(UGeometryCollectionComponent* GCC, FVector HitLocation, float Radius, float Strain);
+
+	// ── Latency Probes ─────────────────────────────────────────────────
+
+	/** Server → owning client: a server-side stage of ProbeId completed. Only sent for
+	 *  non-zero probe ids, so it costs nothing while cat.Latency.Enable is off. */
+	UFUNCTION(Client, Unreliable)
+	void Client_LatencyProbeAck(uint16 ProbeId, ECatLatencyStage Stage);
+
 	// ── Networked Turn State ───────────────────────────────────────────
 
 	/** Client → Server: edge-trigger for turn on/off. Reliable guarantees ordered delivery. */
@@ -488,14 +676,32 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, ReplicatedUsing = OnRep_bDied, Category = "Animation State")
 	bool bDied = false;
 
-	/** True while a mouth grab is active. Replicated so the AnimBP can drive a jaw-open blend on all machines. */
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, ReplicatedUsing = OnRep_bIsGrabbing, Category = "Animation State")
+	/** True while this machine's GrabConstraint holds something. Follows GrabState on every
+	 *  machine, so the AnimBP can drive a jaw-open blend everywhere. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Animation State")
 	bool bIsGrabbing = false;
 
+	/** Server-owned grab state. Late joiners and newly relevant clients get it like any
+	 *  other property and bind their constraint on arrival. */
+	UPROPERTY(ReplicatedUsing = OnRep_GrabState)
+	FCatGrabState GrabState;
+
+	/** Last accepted owner sample of the held body. Skips the owner — it is the source. */
+	UPROPERTY(ReplicatedUsing = OnRep_HeldBodyState)
+	FCatHeldBodyState HeldBodyState;
+
 	/** Current jump phase for AnimBP state machine transitions. */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, ReplicatedUsing = OnRep_JumpPhase, Category = "Animation State")
 	ECatJumpPhase JumpPhase = ECatJumpPhase::None;
 
+	/** True while ragdolled. Each machine enters/exits its local simulation on change. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, ReplicatedUsing = OnRep_bIsRagdoll, Category = "Animation State")
+	bool bIsRagdoll = false;
+
+	/** Server-sampled pelvis state — written only while bIsRagdoll, at RagdollNetUpdateRate. */
+	UPROPERTY(ReplicatedUsing = OnRep_RagdollRootState)
+	FCatRagdollRootState RagdollRootState;
+
 	// ── OnRep Callbacks ─────────────────────────────────────────────────
 
 	UFUNCTION()
@@ -532,7 +738,16 @@ protected:
 	void OnRep_JumpPhase();
 
 	UFUNCTION()
-	void OnRep_bIsGrabbing();
+	void OnRep_GrabState();
+
+	UFUNCTION()
+	void OnRep_HeldBodyState();
+
+	UFUNCTION()
+	void OnRep_bIsRagdoll();
+
+	UFUNCTION()
+	void OnRep_RagdollRootState();
 
 	// ══════════════════════════════════════════════════════════════════
 	// ── Local Cosmetic Variables (NOT replicated) ─────────────────────
@@ -674,9 +889,26 @@ private:
 	/** True while a swat montage is playing — blocks re-entry. */
 	bool bIsSwatting = false;
 
+	// ── Latency Probe State ────────────────────────────────────────────
+
+	/** Server: probe id of the swat currently being traced. 0 = untracked. */
+	uint16 ActiveSwatProbeId = 0;
+
+	/** Server: the SwatServerHit stage fires once per probe, on the first hit of the swipe. */
+	bool bSwatProbeHitAcked = false;
+
+	/** Owning client: grab probe waiting for the locally-observed constraint. */
+	uint16 PendingGrabProbeId = 0;
+
+	/** Acks ProbeId back to the owning client. No-op for untracked probes. */
+	void AckLatencyProbe(uint16 ProbeId, ECatLatencyStage Stage);
+
 	/** Server-authoritative hit processing: applies impulse + broadcasts OnSwatHit. */
 	void HandleSwatHit(const FHitResult& HitResult);
 
+	/** Owning client: applies the swat impulse to its own copy of a predicted prop. No damage, no events. */
+	void PredictSwatImpulse(const FHitResult& HitResult);
+
 	/** Shared helper: plays the swat montage and binds FOnMontageEnded for interruption-safe cleanup. */
 	void PlaySwatMontageAndBindEnd();
 
@@ -684,18 +916,48 @@ private:
 	UFUNCTION()
 	void OnSwatMontageEnded(UAnimMontage* Montage, bool bInterrupted);
 
-	/** Fires when PhysicsBumper overlaps a PhysicsBody. Applies BumperPushForce on authority. */
+	/** BumperChaosImpulse scaled by the cat's current horizontal speed. */
+	float GetBumperStrain() const;
+
+	/** Applies one BumperPushForce impulse per body queued last frame, then expires cooldowns. */
+	void FlushBumperImpulses();
+
+	/** Last processed bumper contact time per component — the cooldown filter. */
+	TMap<TWeakObjectPtr<UPrimitiveComponent>, double> BumperContactTimes;
+
+	/** Bodies to push on the next flush. A set, so repeat contacts in a frame merge. */
+	TSet<TWeakObjectPtr<UPrimitiveComponent>> PendingBumperImpulses;
+
+	/** Fires when PhysicsBumper overlaps a PhysicsBody. GCs don't overlap the bumper — they
+	 *  come from QueryBumperDestructibles. */
 	UFUNCTION()
 	void OnBumperOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
 	    UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep,
 	    const FHitResult& SweepResult);
 
+	/** One new bumper contact. Queues BumperPushForce on authority (the owning client predicts
+	 *  it on props using PredictiveInterpolation) and reports GC hits to the fracture log. */
+	void HandleBumperContact(AActor* OtherActor, UPrimitiveComponent* OtherComp);
+
+	/** Registry radius query standing in for bumper overlaps with GCs: new contacts since the
+	 *  last query go through HandleBumperContact. */
+	void QueryBumperDestructibles();
+
+	/** Destructibles the bumper touched at the last query — contacts begin on entry only. */
+	TSet<uint32> BumperTouchingDestructibles;
+
 	/** Performs the sphere trace and calls Interact on any hit IInteractableInterface actor. Authority only. */
 	void PerformInteractTrace();
 
 	/** Checks auto-release conditions (destroyed or drifted too far). Authority only. */
 	void UpdateGrab(float DeltaTime);
 
+	/** Applies the Grab* tuning (limits, drive, free angular) to GrabConstraint. Called once at BeginPlay. */
+	void ConfigureGrabConstraint();
+
+	/** Detaches GrabConstraint from whatever it holds. The component itself is kept for the next grab. */
+	void UnbindGrabConstraint();
+
 	/** Sets CMC to drag-movement state: reduced MaxWalkSpeed, bOrientRotationToMovement disabled. */
 	void ApplyDragMovementSettings();
 
@@ -727,11 +989,87 @@ private:
 	 *  the Apex→Fall velocity spike. Not replicated; purely a physics-smoothing value. */
 	float GravityScaleInterp = 2.8f;
 
+	// ── Ragdoll State ───────────────────────────────────────────────
+
+	/** Starts/stops the local physics-asset simulation. Runs on every machine. */
+	void EnterRagdollLocal();
+	void ExitRagdollLocal();
+
+	/** Server timer: samples the pelvis body into RagdollRootState. */
+	void SampleRagdollRootState();
+
+	/** Server timer: ends a knockout. */
+	void RecoverFromKnockout();
+
+	/** Keeps the capsule over the pelvis and (clients) steers the pelvis toward the server state. */
+	void UpdateRagdoll(float DeltaTime);
+
+	/** Mesh attachment + collision cached at BeginPlay, restored when standing back up. */
+	FTransform MeshRelativeTransformCache = FTransform::Identity;
+	FName MeshCollisionProfileCache = NAME_None;
+
+	/** Client: world time the last RagdollRootState arrived — used to extrapolate it. */
+	double RagdollStateReceiveTime = 0.0;
+
+	FTimerHandle RagdollSampleTimerHandle;
+	FTimerHandle RagdollRecoverTimerHandle;
+
 	// ── Mouth Grab State ────────────────────────────────────────────
 
-	/** The physics component currently held. Valid only on authority while bIsGrabbing. */
+	/** The physics component this machine's GrabConstraint is bound to. Valid while bIsGrabbing. */
 	TWeakObjectPtr<UPrimitiveComponent> GrabbedComponent;
 
+	/** GrabState.Sequence the local constraint was last brought in line with. */
+	uint8 AppliedGrabSequence = 0;
+
+	/** Brings this machine's constraint in line with GrabState: unbinds a stale grab, binds the new target. */
+	void ApplyGrabState();
+
+	/** Binds GrabConstraint to GrabbedComp and enters drag movement. */
+	void BindGrab(UPrimitiveComponent* GrabbedComp, int16 BoneIndex);
+
+	/** Unbinds GrabConstraint, re-enables strain on the held GC and leaves drag movement. */
+	void ReleaseGrabLocal();
+
+	/** True if the server should hand Target's simulation to this cat's owning client. */
+	bool ShouldOwnerSimulate(const UPrimitiveComponent* Target) const;
+
+	/** Owner: streams the held body at the adaptive rate. Followers: steer toward HeldBodyState. */
+	void UpdateHeldBody(float DeltaTime);
+
+	/** This machine is not simulating the held body itself — it tracks the owner's stream
+	 *  instead of binding GrabConstraint. Gravity is suspended on its copy meanwhile. */
+	bool bFollowingHeldBody = false;
+
+	/** Owning client: the held actor whose ReplicatedMovement is ignored while it simulates
+	 *  the body locally. Restored on release. */
+	TWeakObjectPtr<AActor> SuspendedMovementActor;
+
+	/** Owning client: best grabbable body from the last candidate sweep, and its constraint bone. */
+	TWeakObjectPtr<UPrimitiveComponent> GrabCandidate;
+	int16 GrabCandidateBoneIndex = INDEX_NONE;
+
+	/** Owning client: in-flight candidate sweep, polled next frame like foot IK traces. */
+	FTraceHandle GrabCandidateHandle;
+	float GrabCandidateElapsed = 0.0f;
+
+	/** Owning client: collects the last candidate sweep and issues the next at GrabCandidateQueryRate. */
+	void UpdateGrabCandidate(float DeltaTime);
+
+	/** Nearest unshattered GC whose bounds the grab sweep from Start to End would touch, via the
+	 *  registry rather than a physics query. OutDistance is measured from Start. */
+	UGeometryCollectionComponent* FindGrabbableDestructible(const FVector& Start, const FVector& End, float& OutDistance) const;
+	void SetGrabCandidate(UPrimitiveComponent* Candidate, int16 BoneIndex);
+
+	/** Constraint bone for a hit on Comp, as an index — GCs and rigid meshes use the root body. */
+	static int16 GetGrabBoneIndex(const UPrimitiveComponent* Comp, FName HitBone);
+
+	/** Owner: seconds since the last Server_UpdateHeldBodyState. */
+	float HeldBodySendElapsed = 0.0f;
+
+	/** Client: world time the last HeldBodyState arrived — used to extrapolate it. */
+	double HeldBodyStateReceiveTime = 0.0;
+
 	// ── Turn Commitment & Lean ──────────────────────────────────────
 	FRotator TargetTurnRotation = FRotator::ZeroRotator;
 	float PreviousYaw = 0.0f;
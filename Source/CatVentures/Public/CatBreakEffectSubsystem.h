@@ -0,0 +1,132 @@
+// CatBreakEffectSubsystem.h — Pooled, capped, merged VFX + audio for destruction.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CatBreakEffectSubsystem.generated.h"
+
+class UAudioComponent;
+class UNiagaraComponent;
+class UNiagaraSystem;
+class USoundBase;
+struct FStreamableHandle;
+
+/**
+ * Per-world break effect dispatcher. Destruction code requests an effect; nothing is
+ * spawned on the spot.
+ *
+ * Requests landing within MergeRadius of one already pending this frame merge into it
+ * (the merged count drives the Niagara "BreakCount" user parameter and the volume).
+ * Once per frame the strongest MaxEffectsPerFrame are played on prewarmed Niagara and
+ * audio components; the rest are dropped, as is any request near MaxEffectsPerArea
+ * effects that are still playing. When every pooled component is busy the oldest is
+ * restarted.
+ *
+ * The pools are created, and the effect assets plus every MeowStinger in the
+ * ChaosRewardTable are async-loaded, at world begin play — destruction frames never
+ * spawn a component or block on a load. A stinger that hasn't finished loading falls
+ * back to BreakSound.
+ *
+ * Runs wherever effects are seen: not created on dedicated servers.
+ * Tuning lives in DefaultGame.ini under [/Script/CatVentures.CatBreakEffectSubsystem].
+ */
+UCLASS(Config = Game)
+class CATVENTURES_API UCatBreakEffectSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor — returns nullptr without a world or on a dedicated server. */
+	static UCatBreakEffectSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Queues a break effect for this frame. Stinger overrides BreakSound when loaded. */
+	void RequestBreakEffect(const FVector& Location, float Magnitude = 1.0f,
+		const TSoftObjectPtr<USoundBase>& Stinger = nullptr);
+
+	// ── Tuning ──────────────────────────────────────────────────────
+
+	UPROPERTY(Config)
+	TSoftObjectPtr<UNiagaraSystem> BreakEffect;
+
+	/** Default break sound when the prop's reward row has no MeowStinger. */
+	UPROPERTY(Config)
+	TSoftObjectPtr<USoundBase> BreakSound;
+
+	/** Prewarmed Niagara components. */
+	UPROPERTY(Config)
+	int32 EffectPoolSize = 16;
+
+	/** Prewarmed audio components. */
+	UPROPERTY(Config)
+	int32 AudioPoolSize = 8;
+
+	/** Effects started per frame, strongest first. */
+	UPROPERTY(Config)
+	int32 MaxEffectsPerFrame = 4;
+
+	/** Requests closer than this (cm) in one frame merge into one effect. */
+	UPROPERTY(Config)
+	float MergeRadius = 150.0f;
+
+	/** Radius (cm) of the per-area cap. */
+	UPROPERTY(Config)
+	float AreaRadius = 600.0f;
+
+	/** Effects allowed to be playing at once within AreaRadius of a request. */
+	UPROPERTY(Config)
+	int32 MaxEffectsPerArea = 3;
+
+	/** Seconds an effect counts as playing for the area cap and pool reuse. */
+	UPROPERTY(Config)
+	float EffectLifetime = 2.0f;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FPendingEffect
+	{
+		FVector Location = FVector::ZeroVector;
+		float Magnitude = 0.0f;
+		int32 Count = 0;
+		TSoftObjectPtr<USoundBase> Stinger;
+	};
+
+	struct FPlayingEffect
+	{
+		FVector Location = FVector::ZeroVector;
+		double StartTime = 0.0;
+	};
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UNiagaraComponent>> EffectPool;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UAudioComponent>> AudioPool;
+
+	/** Parallel to the pools: last start time of each slot. */
+	TArray<double> EffectStartTimes;
+	TArray<double> AudioStartTimes;
+
+	TArray<FPendingEffect> Pending;
+	TArray<FPlayingEffect> Playing;
+
+	/** Keeps the effect assets and every reward stinger resident. */
+	TSharedPtr<FStreamableHandle> AssetHandle;
+
+	bool bPoolsReady = false;
+
+	void LoadAssets();
+	void CreatePools();
+	void Dispatch(const FPendingEffect& Effect, double Now);
+
+	/** Free slot, else the one started longest ago. */
+	static int32 AcquireSlot(TArray<double>& StartTimes, double Now, float Lifetime);
+};
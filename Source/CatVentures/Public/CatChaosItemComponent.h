@@ -0,0 +1,83 @@
+// CatChaosItemComponent.h — Native destructible prop: reward row, swat damage response, break hooks.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "CatMatchTypes.h"
+#include "CatChaosItemComponent.generated.h"
+
+class AController;
+class UDamageType;
+
+/**
+ * Native replacement for the Blueprint BPC_ChaosItem. Add one to every GC prop.
+ *
+ * The component owns no tick. It carries the prop's ChaosRewardKey and caches the
+ * matching FChaosRewardData row at BeginPlay, so scoring never searches the table.
+ * On the server it answers point damage (cat swats) by queueing a graded fracture
+ * through the GameState fracture log, like a bumper hit.
+ *
+ * Break detection and scoring are native too: UCatDestructibleSubsystem ingests the
+ * prop's Chaos break events and reports its first break to the GameMode exactly once.
+ * The Blueprint events below are cosmetic only — nothing gameplay-relevant waits on them.
+ */
+UCLASS(ClassGroup = (Cat), meta = (BlueprintSpawnableComponent))
+class CATVENTURES_API UCatChaosItemComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UCatChaosItemComponent();
+
+	/** Row in ACatGameMode::ChaosRewardTable. None = DefaultChaosValue. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Chaos Item")
+	FName ChaosRewardKey;
+
+	/** Row in ACatGameState::FractureTunings used for swat damage. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Chaos Item")
+	uint8 DamageFractureTuning = 0;
+
+	/** Strain injected per point of damage. A swat deals 1 point. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Chaos Item", meta = (ClampMin = "0.0"))
+	float StrainPerDamage = 10000.0f;
+
+	/** Reward row resolved at BeginPlay. Null when the key is None or missing from the table. */
+	const FChaosRewardData* GetRewardData() const { return bHasRewardData ? &RewardData : nullptr; }
+
+	/** Every peer, when a fracture of this prop is applied locally — catch-up replays included,
+	 *  so the first-break state stays right. bPlayEffects = false skips the VFX, audio and
+	 *  OnChaosItemFractured. */
+	void NotifyFractured(const FVector& Origin, bool bPlayEffects);
+
+	/** Rematch: the next fracture counts as the first again. */
+	void ResetItem() { bHasFractured = false; }
+
+	// ── Cosmetic hooks ──────────────────────────────────────────────
+
+	/** Server only — the prop took point damage. Fires before the fracture is queued. */
+	UFUNCTION(BlueprintImplementableEvent, Category = "Chaos Item")
+	void OnChaosItemDamaged(float Damage, FVector HitLocation);
+
+	/** Every peer — a fracture of this prop was applied. The default break VFX and audio
+	 *  are already requested from UCatBreakEffectSubsystem; don't spawn effects here. */
+	UFUNCTION(BlueprintImplementableEvent, Category = "Chaos Item")
+	void OnChaosItemFractured(FVector Origin, bool bFirstBreak);
+
+protected:
+	virtual void BeginPlay() override;
+
+private:
+	UFUNCTION()
+	void HandlePointDamage(AActor* DamagedActor, float Damage, AController* InstigatedBy, FVector HitLocation,
+		UPrimitiveComponent* HitComponent, FName BoneName, FVector ShotFromDirection,
+		const UDamageType* DamageType, AActor* DamageCauser);
+
+	void CacheRewardData();
+
+	/** Copied out of the table — the row map can be rebuilt when the asset reloads. */
+	FChaosRewardData RewardData;
+	bool bHasRewardData = false;
+
+	bool bHasFractured = false;
+};
@@ -0,0 +1,169 @@
+// CatDebrisSubsystem.h — Moves broken GC fragments through settle → demote → freeze → remove.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CatDebrisSubsystem.generated.h"
+
+class UGeometryCollectionComponent;
+
+/** Lifecycle stage of one broken-off leaf fragment. Stages only move forward. */
+UENUM()
+enum class ECatDebrisStage : uint8
+{
+	Active,		// Fully colliding dynamic particle, still moving
+	Demoted,	// Came to rest — collision swapped to DebrisCollisionProfile (ignores cats)
+	Frozen,		// Stayed at rest — anchored, no longer simulated
+	Removed		// Off-screen long enough — particle disabled in the solver
+};
+
+/**
+ * Per-world debris manager. Every GC that fractures on this machine is tracked; at a
+ * fixed interval each broken-off leaf is sampled and advanced:
+ *
+ *   Active  → Demoted  after SettleTime seconds within SettleTolerance of its last sample
+ *   Demoted → Frozen   after a further FreezeDelay seconds at rest
+ *   Frozen  → Removed  once the whole GC has gone unrendered for OffscreenRemoveDelay
+ *
+ * On top of the lifecycle, a world-wide particle budget (cat.Debris.Budget) caps the
+ * live fragments across all GCs. When exceeded, every unprotected fragment is scored by
+ * age, distance to the nearest player and its GC's chaos value, and the worst-ranked
+ * are retired (removed) immediately, whatever their stage or visibility.
+ *
+ * Neither path removes anything outside ECatMatchPhase::Playing, nor on the GCs in
+ * ACatGameState::TopValueSites — the aftermath cameras pan over that debris.
+ *
+ * Runs on every peer: each machine owns its local Chaos debris.
+ * Tuning lives in DefaultGame.ini under [/Script/CatVentures.CatDebrisSubsystem].
+ */
+UCLASS(Config = Game)
+class CATVENTURES_API UCatDebrisSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor — returns nullptr without a world. */
+	static UCatDebrisSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Starts tracking GCC's broken-off fragments. Safe to call on every fracture. */
+	void TrackCollection(UGeometryCollectionComponent* GCC);
+
+	/** Records GCC's chaos value for budget ranking (server: from ACatGameMode's reward
+	 *  lookup). Untagged GCs rank as value 0. Tracks GCC if it isn't already. */
+	void SetCollectionValue(UGeometryCollectionComponent* GCC, float Value);
+
+	/** Stops tracking everything — the GCs are about to be rebuilt from rest. */
+	void Reset();
+
+	/** Live (not removed) broken-off fragments across all tracked GCs, as of the last pass. */
+	int32 GetLiveFragmentCount() const { return LiveFragmentCount; }
+
+	// ── Tuning ──────────────────────────────────────────────────────
+
+	/** Seconds between lifecycle passes. Fragments are sampled, not watched every frame. */
+	UPROPERTY(Config)
+	float UpdateInterval = 0.25f;
+
+	/** Movement (cm) between samples below which a fragment counts as at rest. */
+	UPROPERTY(Config)
+	float SettleTolerance = 1.0f;
+
+	/** Seconds at rest before collision is demoted. */
+	UPROPERTY(Config)
+	float SettleTime = 1.0f;
+
+	/** Further seconds at rest before the fragment is anchored. */
+	UPROPERTY(Config)
+	float FreezeDelay = 3.0f;
+
+	/** Seconds a GC must go unrendered before its frozen fragments are removed. */
+	UPROPERTY(Config)
+	float OffscreenRemoveDelay = 10.0f;
+
+	/** Collision profile applied to demoted fragments. Must ignore Pawn, PhysicsBody and Destructible. */
+	UPROPERTY(Config)
+	FName DebrisCollisionProfile = TEXT("CatDebris");
+
+	/** Max live fragments across all GCs while cat.Debris.Budget is -1. 0 = unlimited. */
+	UPROPERTY(Config)
+	int32 DefaultParticleBudget = 600;
+
+	/** Retirement score weights. Each term is normalized before weighting:
+	 *  age / AgeScale, distance / DistanceScale, value / ValueScale. Higher score = retired first. */
+	UPROPERTY(Config)
+	float AgeWeight = 1.0f;
+
+	UPROPERTY(Config)
+	float DistanceWeight = 1.0f;
+
+	/** Subtracted — valuable props keep their debris longest. */
+	UPROPERTY(Config)
+	float ValueWeight = 1.0f;
+
+	UPROPERTY(Config)
+	float AgeScale = 30.0f;
+
+	UPROPERTY(Config)
+	float DistanceScale = 3000.0f;
+
+	UPROPERTY(Config)
+	float ValueScale = 50.0f;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FDebrisFragment
+	{
+		ECatDebrisStage Stage = ECatDebrisStage::Active;
+		FVector3f LastLocation = FVector3f::ZeroVector;
+
+		/** Seconds this fragment has been continuously at rest. */
+		float RestTime = 0.0f;
+
+		/** Seconds since this fragment broke off (first sampled). */
+		float Age = 0.0f;
+
+		bool bSampled = false;
+	};
+
+	struct FDebrisCollection
+	{
+		TWeakObjectPtr<UGeometryCollectionComponent> GCC;
+
+		/** Indexed by transform index; only broken-off leaves are ever advanced. */
+		TArray<FDebrisFragment> Fragments;
+
+		/** Chaos value of the prop, for budget ranking. */
+		float Value = 0.0f;
+
+		/** Cached per pass — protected GCs are never retired by the budget. */
+		bool bProtected = false;
+
+		/** False once every fragment is Removed — the entry is dropped next pass. */
+		bool bHasLiveFragments = true;
+	};
+
+	TArray<FDebrisCollection> Collections;
+
+	int32 LiveFragmentCount = 0;
+
+	float TimeSinceUpdate = 0.0f;
+
+	/** Advances one GC's fragments. Returns per-stage counts through OutStageCounts. */
+	void UpdateCollection(FDebrisCollection& Collection, float Elapsed, bool bAllowRemoval,
+		int32 (&OutStageCounts)[4]);
+
+	/** True while the match is live and GCActor isn't a protected aftermath site. */
+	bool CanRemoveDebrisOf(const AActor* GCActor) const;
+
+	/** Retires the worst-ranked unprotected fragments until at most Budget remain live.
+	 *  Returns the number retired. */
+	int32 EnforceBudget(int32 Budget);
+
+	FDebrisCollection& FindOrAddCollection(UGeometryCollectionComponent* GCC);
+};
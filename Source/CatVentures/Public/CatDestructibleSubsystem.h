@@ -0,0 +1,255 @@
+// CatDestructibleSubsystem.h — Registry of every GC prop: stable IDs, cached components, spatial hash,
+// break ingestion, destruction state across cell streaming.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CatDestructionTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "CatDestructibleSubsystem.generated.h"
+
+class UGeometryCollectionComponent;
+class UCatHeroBreakComponent;
+class UCatChaosItemComponent;
+class ULevel;
+
+namespace Chaos
+{
+	struct FBreakingEventData;
+}
+
+/** One registered destructible. Pointers are cached at registration — no component searches later. */
+struct FCatDestructibleEntry
+{
+	uint32 Id = 0;
+
+	TWeakObjectPtr<AActor> Actor;
+	TWeakObjectPtr<UGeometryCollectionComponent> GCC;
+
+	/** Set when the prop plays recorded breaks instead of simulating. */
+	TWeakObjectPtr<UCatHeroBreakComponent> Hero;
+
+	/** Reward row and cosmetic hooks. Unset on props that haven't moved off BPC_ChaosItem. */
+	TWeakObjectPtr<UCatChaosItemComponent> Item;
+
+	/** Row in ACatGameMode::ChaosRewardTable, read from the prop's ChaosRewardKey at registration. */
+	FName RewardKey;
+
+	/** Hashed position: the live bounds centre as of the last refresh. Radius is the intact
+	 *  bounds at registration — loose debris inflating the live bounds doesn't widen queries. */
+	FVector Center = FVector::ZeroVector;
+	float Radius = 0.0f;
+
+	FIntVector Cell = FIntVector::ZeroValue;
+
+	/** Nothing left to break on this peer — bumper contacts with it are dropped. */
+	bool bShattered = false;
+
+	/** Server: destruction already scored. Guards against double reports from the
+	 *  native break path and Blueprint callers of ACatGameMode::ReportItemDestroyed. */
+	bool bReported = false;
+
+	/** A stream-in reapply replaced the asset's rest pose with the settled one. */
+	bool bRestStateOverridden = false;
+
+	/** Leaves a stream-in reapply pinned where they lay. */
+	TArray<int32> ReappliedAnchors;
+};
+
+/** A broken prop's state while its cell is streamed out. One bit per GC transform. */
+struct FCatPropDestructionState
+{
+	/** Transform had broken off its parent cluster. */
+	TBitArray<> BrokenOff;
+
+	/** Broken-off leaf whose particle the debris lifecycle had disabled. */
+	TBitArray<> Removed;
+
+	/** Component-space pose of every transform at stream-out. Empty when
+	 *  cat.Destruction.PersistDebrisTransforms is off — broken leaves are then dropped. */
+	TArray<FTransform3f> SettledTransforms;
+
+	bool bReported = false;
+
+	/** No intact cluster was left. A chipped prop keeps its unbroken clusters on reapply. */
+	bool bShattered = false;
+};
+
+/** One destructible that crossed the scoring threshold, handed to the GameMode. */
+struct FCatBreakReport
+{
+	uint32 DestructibleId = 0;
+	FVector Location = FVector::ZeroVector;
+};
+
+/**
+ * Per-world registry of geometry-collection props.
+ *
+ * Every level-placed actor with a UGeometryCollectionComponent is registered when the
+ * world begins play or its level streams in, and dropped when the level streams out.
+ * Each gets a compact ID — the CRC of its PIE-stripped path name — that is identical
+ * on every peer, so the net layer can send a uint32 instead of an actor reference.
+ *
+ * Entries are bucketed in a uniform spatial hash (CellSize) for radius queries — bumper and
+ * grab candidate selection use it instead of physics overlaps against GC particle sets.
+ * Props moved by a push, a grab or a fracture are re-bucketed every tick until they settle.
+ * Runtime-spawned GCs are not registered: their names aren't stable across peers.
+ *
+ * On the server the subsystem also scores destruction natively. A handler on the Chaos
+ * solver's event manager — dispatched on the game thread once per physics sync — resolves
+ * each broken prop once per batch and scores it when it is shattered or the broken-off share
+ * of its pieces reaches cat.Destruction.ScoreBrokenFraction; a first chip doesn't count.
+ * The batch goes to ACatGameMode::ReportItemsDestroyed. Registered GCs get their break
+ * notifications enabled at registration.
+ *
+ * Broken props survive cell streaming. As a level streams out, the state of each prop
+ * that has broken at all, or been scored, is captured into a per-level store; when the
+ * level streams back in, the prop is rebuilt from it without simulating the fracture
+ * again: the settled pose becomes the rest state, the clusters that had released pieces
+ * are crumbled (all of them for a fully shattered prop), and every loose leaf is anchored
+ * where it lay (removed debris stays disabled). Reported/shattered flags carry over, so
+ * nothing is re-scored.
+ *
+ * Fractures that reach a peer before their prop does — a log entry or join snapshot entry
+ * for a cell this peer hasn't streamed in, or one that arrives before the world begins
+ * play — are held by ID and replayed once the prop registers.
+ */
+UCLASS()
+class CATVENTURES_API UCatDestructibleSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static constexpr uint32 InvalidId = 0;
+
+	/** Edge length (cm) of a spatial hash cell. Roughly one shelf's worth of props. */
+	static constexpr float CellSize = 200.0f;
+
+	/** Convenience accessor — returns nullptr without a world. */
+	static UCatDestructibleSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Registers Actor if it carries a GC and has a net-stable name. Returns its ID, or InvalidId. */
+	uint32 RegisterActor(AActor* Actor);
+	void UnregisterActor(const AActor* Actor);
+
+	/** O(1) lookups. Return nullptr / InvalidId for unknown or destroyed entries. */
+	const FCatDestructibleEntry* Find(uint32 Id) const;
+	const FCatDestructibleEntry* FindByActor(const AActor* Actor) const;
+	uint32 GetId(const AActor* Actor) const;
+	AActor* ResolveActor(uint32 Id) const;
+	UGeometryCollectionComponent* ResolveGC(uint32 Id) const;
+
+	/** Appends the IDs of destructibles whose hashed bounds sphere intersects the sphere. */
+	void QueryRadius(const FVector& Center, float Radius, TArray<uint32>& OutIds) const;
+
+	/** Something is moving the destructible (push, grab, fracture): re-bucket it every tick
+	 *  until its bounds stop moving. Cheap to call every frame. */
+	void NotifyMoving(uint32 Id);
+
+	/** Flags the destructible as fully broken on this peer. */
+	void MarkShattered(uint32 Id);
+	bool IsShattered(uint32 Id) const;
+
+	/** Applies Event to this peer's copy of its destructible if it's live here; otherwise holds
+	 *  it until the destructible registers (cell streams in, or the world begins play).
+	 *  bPlayEffects only applies to an immediate apply — deferred replays are silent. */
+	void ApplyOrDeferFracture(const FCatFractureEvent& Event, bool bPlayEffects);
+
+	/** Client: the join snapshot includes every fracture up to Sequence. */
+	void SetSnapshotSequence(uint32 Sequence) { SnapshotSequence = FMath::Max(SnapshotSequence, Sequence); }
+
+	/** True if a fracture log entry with Sequence is already part of the applied join snapshot. */
+	bool IsCoveredBySnapshot(uint32 Sequence) const { return Sequence <= SnapshotSequence; }
+
+	/** Server: flags the destructible as scored. Returns false if it already was. */
+	bool TryMarkReported(uint32 Id);
+
+	/** Rematch: rebuilds every registered GC from its rest collection — undoing any stream-in
+	 *  reapply's rest pose and anchors — re-arms hero and item components, and forgets
+	 *  streamed-out destruction state and deferred fractures. */
+	void ResetDestructibles();
+
+	/** True if From is within Reach of the destructible's current bounds surface. Pushed
+	 *  props move, so this reads the live component bounds. */
+	bool IsInReach(uint32 Id, const FVector& From, float Reach) const;
+
+	/** Every live entry, for systems that sweep all destructibles (debug commands, audits). */
+	const TMap<uint32, FCatDestructibleEntry>& GetEntries() const { return Entries; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	TMap<uint32, FCatDestructibleEntry> Entries;
+	TMap<TObjectKey<AActor>, uint32> IdsByActor;
+	TMap<FIntVector, TArray<uint32>> Cells;
+
+	/** Largest registered bounds radius — queries widen by this so centre-bucketed entries aren't missed. */
+	float MaxEntryRadius = 0.0f;
+
+	/** Entries being re-bucketed, with how many ticks their centre has held still. */
+	TMap<uint32, int32> MovingIds;
+
+	/** Ticks a moving entry must hold within MovingTolerance (cm) before it stops being tracked. */
+	static constexpr int32 MovingSettleTicks = 30;
+	static constexpr float MovingTolerance = 1.0f;
+
+	void UpdateMovingEntries();
+	void MoveEntry(FCatDestructibleEntry& Entry, const FVector& NewCenter);
+
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelPreRemoveHandle;
+	FDelegateHandle LevelRemovedHandle;
+
+	/** Destruction state of streamed-out props, by level package, then destructible ID. */
+	TMap<FName, TMap<uint32, FCatPropDestructionState>> CellStates;
+
+	/** Fractures for destructibles not live on this peer yet, by ID, in arrival order. */
+	TMap<uint32, TArray<FCatFractureEvent>> DeferredFractures;
+
+	/** Set when a registration may have made deferred fractures playable. Tick then replays
+	 *  cat.Destruction.ReplayFracturesPerFrame of them per frame until none are. */
+	bool bReplayDeferred = false;
+
+	/** Last fracture sequence folded into the join snapshot this client received; 0 if none. */
+	uint32 SnapshotSequence = 0;
+
+	bool CanApplyFracture(uint32 Id) const;
+	void ReplayDeferredFractures();
+
+	// ── Break ingestion (server) ────────────────────────────────────
+
+	bool bListeningForBreaks = false;
+
+	void StartBreakListener();
+	void StopBreakListener();
+
+	/** Game thread, from the solver's event dispatch. Scores every prop in the batch that
+	 *  crossed the threshold. */
+	void HandleBreakingEvents(const Chaos::FBreakingEventData& Event);
+
+	/** Shattered, or enough broken off to count as destroyed. */
+	bool HasCrossedScoreThreshold(const FCatDestructibleEntry& Entry) const;
+
+	void HandleLevelAdded(ULevel* Level, UWorld* InWorld);
+	void HandleLevelPreRemove(ULevel* Level, UWorld* InWorld);
+	void HandleLevelRemoved(ULevel* Level, UWorld* InWorld);
+	void RegisterLevel(ULevel* Level);
+
+	/** Snapshots Entry's GC into OutState. False if the prop never broke and wasn't scored. */
+	static bool CaptureDestructionState(const FCatDestructibleEntry& Entry, FCatPropDestructionState& OutState);
+	static void ReapplyDestructionState(FCatDestructibleEntry& Entry, const FCatPropDestructionState& State);
+
+	static FName GetLevelKey(const ULevel* Level);
+
+	static FIntVector ToCell(const FVector& Location);
+
+	static FName ReadRewardKey(const AActor* Actor);
+};
@@ -0,0 +1,168 @@
+// CatDestructionTypes.h — Replicated destruction payloads shared by GameState, cats and props.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/NetSerialization.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "CatDestructionTypes.generated.h"
+
+struct FCatFractureLog;
+class ACatGameState;
+
+/** How a logged fracture is applied to a geometry collection. */
+UENUM(BlueprintType)
+enum class ECatFractureMode : uint8
+{
+	Graded,		// Break only the clusters under the footprint, as deep as the strain justifies
+	Shatter		// ACatBase::ForceShatterGC — every bond in the GC, regardless of the hit
+};
+
+/**
+ * Per-cat fracture constants, indexed by FCatFractureEvent::TuningIndex so the radius and
+ * strain scale cross the wire as one byte instead of two floats.
+ */
+USTRUCT(BlueprintType)
+struct FCatFractureTuning
+{
+	GENERATED_BODY()
+
+	/** Footprint radius (cm) of the strain at the contact point. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta = (ClampMin = "1.0"))
+	float Radius = 200.0f;
+
+	/** Strain carried by an event with StrainFraction 255. Match the cat's
+	 *  BumperChaosImpulse × BumperMaxStrainScale so fast hits don't clip. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta = (ClampMin = "0.0"))
+	float MaxStrain = 30000.0f;
+};
+
+/**
+ * One fracture, logged by the server at the end of the frame it happened in.
+ * Multiple bumper contacts on the same GC within a frame collapse into one entry.
+ */
+USTRUCT()
+struct FCatFractureEvent : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	/** UCatDestructibleSubsystem ID of the geometry collection to fracture. */
+	UPROPERTY()
+	uint32 DestructibleId = 0;
+
+	/** Strain origin (bumper face position). */
+	UPROPERTY()
+	FVector_NetQuantize10 Origin;
+
+	/** Row in ACatGameState::FractureTunings — supplies the radius and strain scale. */
+	UPROPERTY()
+	uint8 TuningIndex = 0;
+
+	/** Strain as a fraction of the tuning row's MaxStrain, 0–255. */
+	UPROPERTY()
+	uint8 StrainFraction = 0;
+
+	/** Hero props only: recorded break variant picked by the server (UCatHeroBreakComponent). */
+	UPROPERTY()
+	uint8 HeroVariant = NoHeroVariant;
+
+	static constexpr uint8 NoHeroVariant = MAX_uint8;
+
+	/** Server-assigned, increasing across the whole session. Join snapshots carry the last
+	 *  sequence they include, so a joiner skips log entries the snapshot already covers. */
+	UPROPERTY()
+	uint32 Sequence = 0;
+
+	/** Snapshot replays of a fully broken prop: shatter regardless of FractureMode. Local only. */
+	UPROPERTY(NotReplicated)
+	bool bForceShatter = false;
+
+	/** Server world time the entry was logged. Server-only — drives expiry. */
+	UPROPERTY(NotReplicated)
+	float LoggedTime = 0.0f;
+
+	/** Client: apply the strain to this machine's Chaos solver as soon as the entry arrives. */
+	void PostReplicatedAdd(const FCatFractureLog& InArraySerializer);
+};
+
+/**
+ * Reliable, delta-replicated log of recent fracture events. Replaces one unreliable
+ * multicast per bumper contact: entries are resent until acknowledged, and each
+ * entry only ever crosses the wire once per connection.
+ *
+ * The server drops entries after ACatGameState::FractureLogLifetime, or oldest-first past
+ * MaxFractureLogEntries, once every connected client has had ample time to receive them.
+ */
+USTRUCT()
+struct FCatFractureLog : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FCatFractureEvent> Events;
+
+	/** Owning GameState — gives arriving items a world to resolve their IDs in. */
+	ACatGameState* OwnerState = nullptr;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FCatFractureEvent, FCatFractureLog>(Events, DeltaParms, *this);
+	}
+};
+
+/** One graded hit kept in a join snapshot entry. */
+USTRUCT()
+struct FCatSnapshotHit
+{
+	GENERATED_BODY()
+
+	/** Strain origin — replayed so debris scatters from the right side. */
+	UPROPERTY()
+	FVector_NetQuantize10 Origin;
+
+	/** Same meaning as FCatFractureEvent::TuningIndex / StrainFraction. */
+	UPROPERTY()
+	uint8 TuningIndex = 0;
+
+	UPROPERTY()
+	uint8 StrainFraction = 0;
+};
+
+/**
+ * One broken GC in the join-in-progress snapshot. Each GC has a single entry however often
+ * it was hit: a fully broken one replays as one shatter, a chipped one as its few strongest
+ * hits, so a joiner ends up as broken as everyone else. Intact GCs cost nothing.
+ */
+USTRUCT()
+struct FCatDestroyedGC
+{
+	GENERATED_BODY()
+
+	/** UCatDestructibleSubsystem ID of the broken GC. */
+	UPROPERTY()
+	uint32 DestructibleId = 0;
+
+	/** Hero props only: the cache variant every other peer played. */
+	UPROPERTY()
+	uint8 HeroVariant = FCatFractureEvent::NoHeroVariant;
+
+	/** Nothing left to break — replay as a shatter from the last hit's origin. */
+	UPROPERTY()
+	bool bShattered = false;
+
+	/** Graded hits in break order, at most MaxHits. */
+	UPROPERTY()
+	TArray<FCatSnapshotHit> Hits;
+
+	static constexpr int32 MaxHits = 4;
+
+	/** Folds a hit in. Past MaxHits it merges into the nearest kept hit (strongest strain
+	 *  wins) — graded damage is local, so that keeps the chips where they were. */
+	void AddHit(const FVector& Origin, uint8 TuningIndex, uint8 StrainFraction);
+};
+
+template<>
+struct TStructOpsTypeTraits<FCatFractureLog> : public TStructOpsTypeTraitsBase2<FCatFractureLog>
+{
+	enum { WithNetDeltaSerializer = true };
+};
@@ -0,0 +1,113 @@
+// CatFootIKComponent.h — Native paw placement fed by batched async ground traces.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "WorldCollision.h"
+#include "CatFootIKComponent.generated.h"
+
+/** Smoothed foot IK output, read by the AnimBP's thread-safe update. */
+USTRUCT(BlueprintType)
+struct FCatFootIKPose
+{
+	GENERATED_BODY()
+
+	/** Per-paw vertical offset (cm) from the mesh origin plane, in FootSockets order. */
+	UPROPERTY(BlueprintReadOnly, Category = "Foot IK")
+	TArray<float> FootOffsets;
+
+	/** Per-paw world rotation that aligns the pad to the ground normal. */
+	UPROPERTY(BlueprintReadOnly, Category = "Foot IK")
+	TArray<FRotator> FootRotations;
+
+	/** Pelvis drop (cm, <= 0) so the lowest paw can reach its ground. */
+	UPROPERTY(BlueprintReadOnly, Category = "Foot IK")
+	float PelvisOffset = 0.0f;
+
+	/** Overall IK weight. Blends to 0 while airborne. */
+	UPROPERTY(BlueprintReadOnly, Category = "Foot IK")
+	float Alpha = 0.0f;
+};
+
+/**
+ * Native replacement for the Blueprint CompBP_IK_ANX paw traces.
+ *
+ * The component owns no tick and issues no traces itself. It registers with
+ * UCatFootIKSubsystem, which once per frame collects last frame's results for every
+ * cat, smooths them, and queues the next round of paw traces for all cats as one
+ * batch of async line traces. Cats that are airborne, off-screen, or on a dedicated
+ * server issue no traces at all.
+ *
+ * AnimBP: read GetFootIKPose() from the thread-safe update (Property Access).
+ */
+UCLASS(ClassGroup = (Cat), meta = (BlueprintSpawnableComponent))
+class CATVENTURES_API UCatFootIKComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UCatFootIKComponent();
+
+	/** Paw sockets to trace under, in the order FootOffsets/FootRotations are reported. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Foot IK")
+	TArray<FName> FootSockets;
+
+	/** Trace start height (cm) above the mesh origin plane. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Foot IK", meta = (ClampMin = "0.0"))
+	float TraceUpDistance = 30.0f;
+
+	/** Trace end depth (cm) below the mesh origin plane. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Foot IK", meta = (ClampMin = "0.0"))
+	float TraceDownDistance = 45.0f;
+
+	/** Clamp (cm) on each paw's vertical offset — keeps a missed trace from folding a leg. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Foot IK", meta = (ClampMin = "0.0"))
+	float MaxFootOffset = 25.0f;
+
+	/** Interp speed for offsets, rotations and alpha. Higher = snappier, more pops. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Foot IK", meta = (ClampMin = "1.0"))
+	float InterpSpeed = 15.0f;
+
+	/** A cat not rendered within this many seconds counts as off-screen and stops tracing. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Foot IK", meta = (ClampMin = "0.0"))
+	float OffScreenTimeout = 0.25f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Foot IK")
+	TEnumAsByte<ECollisionChannel> TraceChannel = ECC_Visibility;
+
+	/** Latest smoothed pose. Safe to call from the animation worker thread. */
+	UFUNCTION(BlueprintPure, Category = "Foot IK", meta = (BlueprintThreadSafe))
+	FCatFootIKPose GetFootIKPose() const { return Pose; }
+
+	// ── Driven by UCatFootIKSubsystem ──────────────────────────────────
+
+	/** Reads back last frame's async results and smooths the pose toward them. */
+	void ConsumeTraceResults(UWorld* World, float DeltaTime);
+
+	/** Queues this frame's paw traces into the world's async batch. Returns traces issued. */
+	int32 IssueTraces(UWorld* World);
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+	/** Per-paw trace bookkeeping. Raw = last trace result; the pose interpolates toward it. */
+	struct FPawTrace
+	{
+		FTraceHandle Handle;
+		float RawOffset = 0.0f;
+		FRotator RawRotation = FRotator::ZeroRotator;
+	};
+
+	TArray<FPawTrace> Paws;
+
+	FCatFootIKPose Pose;
+
+	/** False while airborne or off-screen — traces are skipped and Alpha fades out. */
+	bool bTracingActive = false;
+
+	USkeletalMeshComponent* GetOwnerMesh() const;
+	bool ShouldTrace() const;
+};
@@ -0,0 +1,43 @@
+// CatFootIKSubsystem.h — Batches every cat's paw traces into one async round per frame.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CatFootIKSubsystem.generated.h"
+
+class UCatFootIKComponent;
+
+/**
+ * Drives all UCatFootIKComponents in the world from a single tick:
+ *   1. Consume — read back the async traces queued last frame, smooth each pose.
+ *   2. Issue   — queue this frame's traces for every eligible cat.
+ * The engine runs all async traces queued in a frame together on worker threads,
+ * so the game thread never blocks on a paw trace.
+ *
+ * Not created on dedicated servers — nobody sees the paws there.
+ */
+UCLASS()
+class CATVENTURES_API UCatFootIKSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	void RegisterComponent(UCatFootIKComponent* Component);
+	void UnregisterComponent(UCatFootIKComponent* Component);
+
+	/** Traces issued in the most recent frame (all cats). */
+	int32 GetLastFrameTraceCount() const { return LastFrameTraceCount; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	TArray<TWeakObjectPtr<UCatFootIKComponent>> Components;
+
+	int32 LastFrameTraceCount = 0;
+};
@@ -8,6 +8,10 @@
 #include "CatGameMode.generated.h"
 
 class UDataTable;
+class ULevel;
+class UPrimitiveComponent;
+struct FCatBreakReport;
+struct FCatDestructibleEntry;
 
 UCLASS()
 class CATVENTURES_API ACatGameMode : public AGameModeBase
@@ -17,12 +21,26 @@ class CATVENTURES_API ACatGameMode : public AGameModeBase
 public:
 	// ── Score Reporting ─────────────────────────────────────────────
 
-	/** Called by BPC_ChaosItem (Blueprint) when a GC actor is destroyed.
+	/** Called by Blueprint (legacy BPC_ChaosItem) when a GC actor is destroyed.
 	 *  ChaosRewardKey names a row in ChaosRewardTable; the GameMode resolves the score,
-	 *  display name, and stinger authoritatively. Triggers match-end if threshold is reached. */
+	 *  display name, and stinger authoritatively. Triggers match-end if threshold is reached.
+	 *  Registered props already scored by the native break path are ignored. */
 	UFUNCTION(BlueprintCallable, Category = "Match")
 	void ReportItemDestroyed(AActor* Item, FVector Location, FName ChaosRewardKey);
 
+	/** Native path: one break-event batch's worth of props that UCatDestructibleSubsystem
+	 *  judged destroyed. Scores the whole batch, then runs the threshold check once. */
+	void ReportItemsDestroyed(TConstArrayView<FCatBreakReport> Reports);
+
+	// ── Rematch ─────────────────────────────────────────────────────
+
+	/** Starts a fresh match on the loaded map without travelling. Every GC is rebuilt from
+	 *  its rest collection on every peer, toys return to their start poses, scores and
+	 *  destruction records are cleared, and every cat is respawned. No prop actor is
+	 *  created or destroyed. Typically called from the aftermath scoreboard. */
+	UFUNCTION(BlueprintCallable, Category = "Match")
+	void ResetMatchInPlace();
+
 	// ── Tuning ──────────────────────────────────────────────────────
 
 	/** DataTable of FChaosRewardData rows — one per breakable prop type.
@@ -51,12 +69,20 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Match|Tuning", meta = (ClampMin = "0.1"))
 	float FadeDuration = 2.0f;
 
+	/** Destroyed items whose debris is protected from cleanup (mirrors the aftermath top-3). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Match|Tuning", meta = (ClampMin = "0"))
+	int32 ProtectedSiteCount = 3;
+
 	/** Time dilation applied during Phases 1, 2, and Fade. 0.2 = 5× slow-mo. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Match|Tuning", meta = (ClampMin = "0.01", ClampMax = "1.0"))
 	float SlowMoDilation = 0.2f;
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** Join-in-progress: ships the current destruction snapshot to the new connection. */
+	virtual void PostLogin(APlayerController* NewPlayer) override;
 
 private:
 	// ── Phase Transitions ───────────────────────────────────────────
@@ -77,6 +103,17 @@ private:
 	/** Every destroyed item recorded during the match (sorted at match end for top-3). */
 	TArray<FDestroyedItemRecord> DestroyedItems;
 
+	/** Running top-ProtectedSiteCount destroyed items by value, highest first. */
+	TArray<TPair<TWeakObjectPtr<AActor>, float>> TopValueItems;
+
+	void UpdateTopValueSites(AActor* Item, float Value);
+
+	/** Resolves the reward row and records one destroyed item. Returns the chaos value added. */
+	float RecordDestroyedItem(AActor* Item, const FCatDestructibleEntry* Entry, const FVector& Location, FName ChaosRewardKey);
+
+	/** Pushes the running score to GameState and starts the match end once the threshold is met. */
+	void CommitChaosScore(AActor* LastItem, const FVector& LastLocation);
+
 	/** Location of the final object that triggered the match end. */
 	FVector FinalBreakLocation = FVector::ZeroVector;
 
@@ -84,4 +121,16 @@ private:
 	TWeakObjectPtr<AActor> FinalBreakActor;
 
 	FTimerHandle PhaseTimerHandle;
+
+	// ── Rematch ─────────────────────────────────────────────────────
+
+	/** Start pose of every simulating non-GC body (toys, seesaw planks, loot), captured
+	 *  at BeginPlay and as cells stream in. */
+	TMap<TWeakObjectPtr<UPrimitiveComponent>, FTransform> PropRestPoses;
+
+	FDelegateHandle LevelAddedHandle;
+
+	void HandleLevelAdded(ULevel* Level, UWorld* InWorld);
+	void CapturePropRestPoses(const ULevel* Level);
+	void ResetPropPoses();
 };
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/GameStateBase.h"
 #include "CatMatchTypes.h"
+#include "CatDestructionTypes.h"
 #include "CatGameState.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnMatchPhaseChanged, ECatMatchPhase, NewPhase);
@@ -15,7 +16,11 @@ class CATVENTURES_API ACatGameState : public AGameStateBase
 	GENERATED_BODY()
 
 public:
+	ACatGameState();
+
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void Tick(float DeltaSeconds) override;
+	virtual void PostInitializeComponents() override;
 
 	// ── Replicated Match State ──────────────────────────────────────
 
@@ -39,10 +44,81 @@ public:
 	UPROPERTY(ReplicatedUsing = OnRep_TopDestroyedLocations, BlueprintReadOnly, Category = "Match")
 	TArray<FVector> TopDestroyedLocations;
 
+	/** Most valuable destroyed GC actors so far, highest first (live during Playing).
+	 *  UCatDebrisSubsystem never removes their debris — the aftermath cameras need it. */
+	UPROPERTY(Replicated, BlueprintReadOnly, Category = "Match")
+	TArray<TObjectPtr<AActor>> TopValueSites;
+
 	/** Per-player scores for the scoreboard. */
 	UPROPERTY(Replicated, BlueprintReadOnly, Category = "Match")
 	TArray<FCatPlayerScore> PlayerScores;
 
+	// ── Fracture Log ────────────────────────────────────────────────
+
+	/** Recent GC fractures, delta-replicated. Clients apply each entry on arrival. */
+	UPROPERTY(Replicated)
+	FCatFractureLog FractureLog;
+
+	/** Seconds an entry stays in the log before the server drops it. Long enough that a
+	 *  client riding out a multi-second stall or packet-loss burst still receives every
+	 *  entry; joiners skip what their snapshot already covers, so length costs them nothing. */
+	UPROPERTY(EditDefaultsOnly, Category = "Fracture", meta = (ClampMin = "0.1"))
+	float FractureLogLifetime = 30.0f;
+
+	/** Hard cap on logged entries; the oldest go first. Bounds the log during chain
+	 *  reactions, when the lifetime alone would let it grow with the fracture rate. */
+	UPROPERTY(EditDefaultsOnly, Category = "Fracture", meta = (ClampMin = "1"))
+	int32 MaxFractureLogEntries = 512;
+
+	/**
+	 * Server only: queue a fracture for this frame. All calls for the same destructible in a
+	 * frame collapse into one entry (strongest strain wins). The queue is flushed into
+	 * FractureLog — and applied on the server's own solver — at the end of the frame.
+	 */
+	void QueueFractureEvent(uint32 DestructibleId, const FVector& Origin, uint8 TuningIndex, float Strain);
+
+	/** Radius / strain-scale rows referenced by fracture entries. Class default, so every
+	 *  peer decodes the same values. Cats pick a row with BumperFractureTuning. */
+	UPROPERTY(EditDefaultsOnly, Category = "Fracture")
+	TArray<FCatFractureTuning> FractureTunings;
+
+	/** Row TuningIndex, or row 0 when out of range. */
+	const FCatFractureTuning& GetFractureTuning(uint8 TuningIndex) const;
+
+	/** How fracture entries are applied. Must match on every peer, so clients take the
+	 *  server's value by replication; cat.Fracture.Mode on the server overrides the class
+	 *  default at runtime for A/B profiling. */
+	UPROPERTY(EditDefaultsOnly, Replicated, Category = "Fracture")
+	ECatFractureMode FractureMode = ECatFractureMode::Graded;
+
+	/** Applies a fracture entry to this machine's local Chaos solver, honouring FractureMode.
+	 *  bPlayEffects = false for catch-up replays (join snapshot, deferred fractures). */
+	void ApplyFractureEvent(const FCatFractureEvent& Event, bool bPlayEffects = true) const;
+
+	/** Shatters the destructible's GC on this machine's local Chaos solver, or plays
+	 *  HeroVariant's recorded cache if it is a hero prop. */
+	static void ApplyFracture(const UObject* WorldContextObject, uint32 DestructibleId, const FVector& Origin,
+		uint8 HeroVariant = FCatFractureEvent::NoHeroVariant);
+
+	/** Fracture mode of WorldContextObject's world — the server's, replicated. */
+	static ECatFractureMode GetFractureMode(const UObject* WorldContextObject);
+
+	/** Server only: every GC broken so far this match, one entry each. Sent to late joiners. */
+	const TArray<FCatDestroyedGC>& GetDestructionSnapshot() const { return DestructionSnapshot; }
+
+	/** Server only: FCatFractureEvent::Sequence of the last fracture folded into the snapshot. */
+	uint32 GetDestructionSnapshotSequence() const { return LastFractureSequence; }
+
+	// ── Rematch ─────────────────────────────────────────────────────
+
+	/** Server: back to Playing with zeroed scores and an empty fracture log / snapshot. */
+	void ResetMatchState();
+
+	/** Every peer rebuilds its local GCs — Chaos state isn't replicated, so each solver
+	 *  resets its own copy. */
+	UFUNCTION(NetMulticast, Reliable)
+	void Multicast_ResetDestructibles();
+
 	// ── Delegates ───────────────────────────────────────────────────
 
 	/** Broadcast locally when MatchPhase replicates — UI widgets bind to this. */
@@ -61,4 +137,26 @@ protected:
 
 	UFUNCTION()
 	void OnRep_TopDestroyedLocations();
+
+private:
+	/** This frame's fractures, one per destructible ID. Flushed in Tick. */
+	TMap<uint32, FCatFractureEvent> PendingFractures;
+
+	/** Server: one entry per GC that broke, merged from every fracture that still had something
+	 *  to break. Late joiners replay it through ApplyFractureEvent, so graded damage arrives as
+	 *  graded damage. Not a replicated property — ACatGameMode::PostLogin ships it to each
+	 *  new connection in chunks. */
+	TArray<FCatDestroyedGC> DestructionSnapshot;
+
+	/** DestructionSnapshot index by destructible ID. */
+	TMap<uint32, int32> SnapshotIndexById;
+
+	/** Sequence of the last logged fracture. Never reset, so it stays increasing across rematches. */
+	uint32 LastFractureSequence = 0;
+
+	void FlushPendingFractures();
+
+	/** Server: folds the cat.Fracture.Mode override into the replicated FractureMode. */
+	void UpdateFractureMode();
+	void ExpireFractureLog();
 };
@@ -0,0 +1,69 @@
+// CatHeroBreakComponent.h — Plays a pre-recorded Chaos cache instead of simulating a hero prop's break.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "CatHeroBreakComponent.generated.h"
+
+class AChaosCacheManager;
+
+/** One recorded break of the prop, and the side it was hit from when recorded. */
+USTRUCT(BlueprintType)
+struct FCatHeroBreakVariant
+{
+	GENERATED_BODY()
+
+	/** Prop-local direction from the prop's centre toward the recorded hit. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Hero Break")
+	FVector HitDirection = FVector::ForwardVector;
+
+	/** Cache manager in the level observing this prop's GC. Set it to Play mode with a
+	 *  Triggered start so nothing plays until the prop is hit. */
+	UPROPERTY(EditInstanceOnly, BlueprintReadOnly, Category = "Hero Break")
+	TObjectPtr<AChaosCacheManager> CacheManager;
+};
+
+/**
+ * Marks a GC prop as a hero destructible. When a fracture for this actor arrives
+ * (fracture log, join snapshot), the prop plays back one recorded Chaos cache
+ * instead of running the live strain simulation.
+ *
+ * The server picks the variant from the hit direction and replicates its index with
+ * the fracture, so every peer plays the same recording and sees the same debris.
+ * Peers pay playback cost only. Hero props are left out of UCatDebrisSubsystem —
+ * the cache owns their particle transforms.
+ *
+ * Record each variant in the editor by breaking the prop from that side with the
+ * manager in Record mode.
+ */
+UCLASS(ClassGroup = (Cat), meta = (BlueprintSpawnableComponent))
+class CATVENTURES_API UCatHeroBreakComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UCatHeroBreakComponent();
+
+	/** Recorded breaks to choose from. At most 255. */
+	UPROPERTY(EditInstanceOnly, BlueprintReadOnly, Category = "Hero Break")
+	TArray<FCatHeroBreakVariant> Variants;
+
+	/** Index of the variant whose HitDirection best matches a hit at WorldHitLocation,
+	 *  or FCatFractureEvent::NoHeroVariant when no variant is set up. */
+	uint8 SelectVariant(const FVector& WorldHitLocation) const;
+
+	/** Triggers the variant's cache playback. The first call wins — later fractures of an
+	 *  already-playing prop are ignored. Returns false if the variant isn't playable. */
+	bool PlayVariant(uint8 VariantIndex);
+
+	UFUNCTION(BlueprintPure, Category = "Hero Break")
+	bool HasPlayed() const { return bHasPlayed; }
+
+	/** Rematch: puts every variant's observed components back to their recorded start
+	 *  pose and allows the next fracture to play again. */
+	void ResetBreak();
+
+private:
+	bool bHasPlayed = false;
+};
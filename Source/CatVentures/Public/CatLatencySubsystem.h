@@ -0,0 +1,100 @@
+// CatLatencySubsystem.h — Input-to-effect latency probes with per-session percentile histograms.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "CatLatencySubsystem.generated.h"
+
+/** Measured points along an input's path to its visible result.
+ *  Every stage is timed against the local key press on the owning client's clock. */
+UENUM(BlueprintType)
+enum class ECatLatencyStage : uint8
+{
+	SwatMontageStart,	// Local predicted montage began playing
+	SwatServerAck,		// Server_Swat arrived on the server
+	SwatServerHit,		// HandleSwatHit ran on the server (first hit of the swipe)
+	SwatImpulse,		// Server applied the swat impulse to a simulating body
+	GrabServerAck,		// Server_Grab arrived on the server
+	GrabConstraint,		// GrabState arrived and bound the constraint on the owning client
+	MeowBroadcast,		// OnMeow broadcast on the owning client
+	MAX					UMETA(Hidden)
+};
+
+/**
+ * Fixed-bucket latency histogram. 1 ms buckets up to MaxTrackedMs; anything slower
+ * lands in the overflow bucket. Percentiles resolve to the bucket's upper edge.
+ */
+struct FCatLatencyHistogram
+{
+	static constexpr int32 MaxTrackedMs = 1000;
+
+	void Add(double Ms);
+	void Reset();
+
+	/** Returns the latency (ms) at or below which Percentile [0, 1] of samples fall. */
+	double GetPercentile(double Percentile) const;
+
+	int32 GetCount() const { return Count; }
+	double GetMeanMs() const { return Count > 0 ? SumMs / Count : 0.0; }
+	double GetMaxMs() const { return MaxMs; }
+
+private:
+	/** [0, MaxTrackedMs) = 1 ms buckets, [MaxTrackedMs] = overflow. Sized lazily on first Add. */
+	TArray<uint32> Buckets;
+
+	int32  Count = 0;
+	double SumMs = 0.0;
+	double MaxMs = 0.0;
+};
+
+/**
+ * Owning-client latency tracker. Lives on the GameInstance so a histogram spans the
+ * whole session, across map travel.
+ *
+ * Flow: the input handler calls BeginProbe() and sends the returned id along with its
+ * Server RPC. Stages that complete locally call MarkStage() directly; server-side stages
+ * are echoed back through ACatBase::Client_LatencyProbeAck so every delta is measured on
+ * one clock. A probe id of 0 means "not tracked" and costs nothing on the wire beyond the id.
+ *
+ * Console:
+ *   cat.Latency.Enable 1     — start issuing probes (off by default)
+ *   cat.Latency.Export [path] — write percentiles to CSV (default Saved/Profiling/CatLatency)
+ *   cat.Latency.Reset        — clear all histograms
+ */
+UCLASS()
+class CATVENTURES_API UCatLatencySubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor — returns nullptr without a world or game instance. */
+	static UCatLatencySubsystem* Get(const UObject* WorldContextObject);
+
+	/** Stamps the current time and returns a non-zero probe id, or 0 when probing is disabled. */
+	uint16 BeginProbe();
+
+	/** Records Now - StartTime for the probe into Stage's histogram. Unknown ids are ignored. */
+	void MarkStage(uint16 ProbeId, ECatLatencyStage Stage);
+
+	/** Writes one row per stage (count, mean, p50, p90, p99, max) to a CSV file. */
+	UFUNCTION(BlueprintCallable, Category = "Latency")
+	bool ExportCsv(const FString& FilePath) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Latency")
+	void ResetHistograms();
+
+	/** True when cat.Latency.Enable is set. Input handlers skip all probe work otherwise. */
+	static bool IsEnabled();
+
+private:
+	/** Probe id → FPlatformTime::Seconds() at key press. */
+	TMap<uint16, double> PendingProbes;
+
+	FCatLatencyHistogram Histograms[static_cast<int32>(ECatLatencyStage::MAX)];
+
+	uint16 NextProbeId = 1;
+
+	/** Drops probes whose acks never arrived (unreliable ack lost, swat missed, etc.). */
+	void PruneStaleProbes(double Now);
+};
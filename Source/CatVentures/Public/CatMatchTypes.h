@@ -50,7 +50,7 @@ struct FCatPlayerScore
 };
 
 /** DataTable row describing what happens when a given prop type is destroyed.
- *  The table asset is assigned on ACatGameMode; each BPC_ChaosItem references
+ *  The table asset is assigned on ACatGameMode; each UCatChaosItemComponent references
  *  a row by FName key. */
 USTRUCT(BlueprintType)
 struct FChaosRewardData : public FTableRowBase
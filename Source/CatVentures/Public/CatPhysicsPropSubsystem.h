@@ -0,0 +1,101 @@
+// CatPhysicsPropSubsystem.h — Puts cat-pushable physics props on predictive physics replication.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CatPhysicsPropSubsystem.generated.h"
+
+class ULevel;
+class UPrimitiveComponent;
+
+/**
+ * Per-world owner of rigid-body prop replication.
+ *
+ * Every level-placed actor whose root is a simulating primitive and which replicates
+ * movement is tracked when the world begins play or its level streams in. Each gets the
+ * physics replication mode selected by cat.Props.PhysicsReplicationMode — by default
+ * PredictiveInterpolation, which blends clients toward the server's extrapolated state
+ * instead of snapping, and tolerates the locally predicted impulses ACatBase applies on
+ * the owning client (bumper pushes, swats). Changing the cvar re-applies the mode to every
+ * tracked prop next tick, so the two modes can be compared in one session.
+ *
+ * Geometry collections are left alone — every peer simulates its own GC fracture.
+ *
+ * Clients count server corrections: each time a new ReplicatedMovement sample arrives for
+ * an awake prop, a correction is counted if the local body sits more than CorrectionDistance
+ * from that sample extrapolated by the one-way latency. Local collisions and bounces don't
+ * count — only disagreement with the server does. Tallies are kept per replication mode;
+ * 'cat.Props.ReportCorrections' logs them side by side, and 'stat CatVentures' shows the
+ * running total. Per-prop bandwidth is the actor's ReplicatedMovement row in Network Insights.
+ *
+ * Tuning lives in DefaultGame.ini under [/Script/CatVentures.CatPhysicsPropSubsystem].
+ */
+UCLASS(Config = Game)
+class CATVENTURES_API UCatPhysicsPropSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor — returns nullptr without a world. */
+	static UCatPhysicsPropSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** True if Comp's actor is replicated with a mode that reconciles locally predicted impulses. */
+	static bool IsPredictedProp(const UPrimitiveComponent* Comp);
+
+	/** Number of props currently tracked. */
+	int32 GetPropCount() const { return Props.Num(); }
+
+	/** Logs server samples and corrections received under each replication mode. */
+	void ReportCorrections() const;
+
+	// ── Tuning ──────────────────────────────────────────────────────
+
+	/** Client: distance (cm) between the local body and a newly arrived server sample that counts as a correction. */
+	UPROPERTY(Config)
+	float CorrectionDistance = 5.0f;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FTrackedProp
+	{
+		TWeakObjectPtr<UPrimitiveComponent> Body;
+
+		/** Last ReplicatedMovement seen, to tell a new server sample from a repeat. */
+		FVector LastServerLocation = FVector::ZeroVector;
+		FVector LastServerVelocity = FVector::ZeroVector;
+	};
+
+	/** Client tally for one replication mode. */
+	struct FCorrectionTally
+	{
+		int32 Samples = 0;
+		int32 Corrections = 0;
+		double AwakeSeconds = 0.0;
+	};
+
+	TArray<FTrackedProp> Props;
+
+	/** Indexed by cat.Props.PhysicsReplicationMode value. */
+	FCorrectionTally Tallies[2];
+
+	/** Mode most recently applied to Props, as a cat.Props.PhysicsReplicationMode value. */
+	int32 AppliedMode = INDEX_NONE;
+
+	FDelegateHandle LevelAddedHandle;
+
+	void HandleLevelAdded(ULevel* Level, UWorld* InWorld);
+	void RegisterLevel(ULevel* Level);
+	void ApplyMode(int32 Mode);
+
+	/** Client: checks awake props against newly arrived server samples and counts corrections. */
+	void CountCorrections(float DeltaTime);
+};
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/PlayerController.h"
 #include "CatMatchTypes.h"
+#include "CatDestructionTypes.h"
 #include "PauseMenuWidget.h"
 #include "CatPlayerController.generated.h"
 
@@ -33,6 +34,24 @@ public:
 	UFUNCTION(Client, Reliable)
 	void Client_OnMatchPhaseChanged(ECatMatchPhase NewPhase, FVector PhaseLocation, AActor* TargetActor);
 
+	// ── Join In Progress ────────────────────────────────────────────
+
+	/** Server → joining client: one chunk of the GCs broken before this player arrived.
+	 *  bFirstChunk starts a new snapshot; Sequence is the last fracture it includes.
+	 *  Applied over several frames (SnapshotFracturesPerFrame) so the join doesn't hitch.
+	 *  Entries for props this client hasn't loaded wait in UCatDestructibleSubsystem. */
+	UFUNCTION(Client, Reliable)
+	void Client_ReceiveDestructionSnapshot(const TArray<FCatDestroyedGC>& Chunk, uint32 Sequence, bool bFirstChunk);
+
+	/** Snapshot entries per Client_ReceiveDestructionSnapshot. Keeps each RPC well under
+	 *  MaxRepArraySize and the bunch size limit however much of the level is broken. */
+	static constexpr int32 SnapshotChunkSize = 64;
+
+	/** Snapshot entries applied per frame while catching up. Each one wakes a GC and
+	 *  spawns its debris, so keep this small. */
+	UPROPERTY(EditAnywhere, Category = "Match", meta = (ClampMin = "1"))
+	int32 SnapshotFracturesPerFrame = 4;
+
 	/** Look-only mapping context — contains only IA_Look.
 	 *  Swapped in during Phase 1 to strip movement while preserving camera look.
 	 *  Assign IMC_LookOnly in the Blueprint subclass. */
@@ -72,11 +91,20 @@ private:
 
 	// ── Phase Handlers ──────────────────────────────────────────────
 
+	void HandlePhase_Playing();
 	void HandlePhase_Warning();
 	void HandlePhase_FinalCut(FVector BreakLocation, AActor* TargetActor);
 	void HandlePhase_Fade();
 	void HandlePhase_Aftermath();
 
+	// ── Join In Progress ────────────────────────────────────────────
+
+	/** Snapshot being applied; entries before PendingSnapshotIndex are applied or deferred. */
+	TArray<FCatDestroyedGC> PendingSnapshot;
+	int32 PendingSnapshotIndex = 0;
+
+	void ApplySnapshotSlice();
+
 protected:
 	// ── Blueprint Implementable Events ──────────────────────────────
 	// C++ handles engine-level work (input mode, dilation).
@@ -95,4 +123,9 @@ protected:
 	 *  and cuts to the level panning camera. */
 	UFUNCTION(BlueprintImplementableEvent, Category = "Match")
 	void OnShowScoreboard();
+
+	/** Rematch: Blueprint removes the scoreboard and any cinematic camera it spawned.
+	 *  Input and view target are already restored by the new possession. */
+	UFUNCTION(BlueprintImplementableEvent, Category = "Match")
+	void OnMatchRestarted();
 };
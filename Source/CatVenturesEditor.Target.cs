@@ -10,6 +10,6 @@ public class CatVenturesEditorTarget : TargetRules
 		Type = TargetType.Editor;
 		DefaultBuildSettings = BuildSettingsVersion.V6;
 		IncludeOrderVersion = EngineIncludeOrderVersion.Unreal5_7;
-		ExtraModuleNames.Add("CatVentures");
+		ExtraModuleNames.AddRange(new string[] { "CatVentures", "CatVenturesEditor" });
 	}
 }
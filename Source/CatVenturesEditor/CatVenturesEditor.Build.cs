@@ -0,0 +1,15 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class CatVenturesEditor : ModuleRules
+{
+	public CatVenturesEditor(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine" });
+
+		PrivateDependencyModuleNames.AddRange(new string[] { "CatVentures", "UnrealEd", "AssetRegistry", "GeometryCollectionEngine", "Chaos", "ChaosSolverEngine", "PhysicsCore" });
+	}
+}
@@ -0,0 +1,8 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CatVenturesEditor.h"
+#include "Modules/ModuleManager.h"
+
+DEFINE_LOG_CATEGORY(LogCatVenturesEditor);
+
+IMPLEMENT_MODULE( FDefaultModuleImpl, CatVenturesEditor );
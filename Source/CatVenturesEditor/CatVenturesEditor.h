@@ -0,0 +1,8 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Editor-only tooling for CatVentures: commandlets and content audits. */
+DECLARE_LOG_CATEGORY_EXTERN(LogCatVenturesEditor, Log, All);
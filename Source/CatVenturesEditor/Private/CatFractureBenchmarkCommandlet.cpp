@@ -0,0 +1,285 @@
+// CatFractureBenchmarkCommandlet.cpp
+
+#include "CatFractureBenchmarkCommandlet.h"
+#include "CatVenturesEditor.h"
+#include "CatBase.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/Engine.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "Components/StaticMeshComponent.h"
+#include "GeometryCollection/GeometryCollectionActor.h"
+#include "GeometryCollection/GeometryCollectionComponent.h"
+#include "GeometryCollection/GeometryCollectionObject.h"
+#include "GeometryCollection/Facades/CollectionDynamicStateFacade.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Physics/Experimental/PhysScene_Chaos.h"
+#include "PhysicsEngine/PhysicsSettings.h"
+#include "PhysicsSolver.h"
+#include "UObject/UObjectGlobals.h"
+
+UCatFractureBenchmarkCommandlet::UCatFractureBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UCatFractureBenchmarkCommandlet::Main(const FString& Params)
+{
+	FString AssetsParam, PathParam = TEXT("/Game"), StrainsParam = TEXT("500,5000,50000,shatter"), OutputParam;
+	float Seconds = 5.0f;
+	float StepHz = 60.0f;
+
+	FParse::Value(*Params, TEXT("Assets="), AssetsParam, /*bShouldStopOnSeparator=*/false);
+	FParse::Value(*Params, TEXT("Path="), PathParam);
+	FParse::Value(*Params, TEXT("Strains="), StrainsParam, /*bShouldStopOnSeparator=*/false);
+	FParse::Value(*Params, TEXT("Output="), OutputParam);
+	FParse::Value(*Params, TEXT("Seconds="), Seconds);
+	FParse::Value(*Params, TEXT("Hz="), StepHz);
+
+	Seconds = FMath::Max(Seconds, 0.1f);
+	StepHz  = FMath::Clamp(StepHz, 10.0f, 240.0f);
+
+	TArray<float> Strains;
+	TArray<FString> StrainTokens;
+	StrainsParam.ParseIntoArray(StrainTokens, TEXT(","));
+	for (const FString& Token : StrainTokens)
+	{
+		Strains.Add(Token.TrimStartAndEnd().Equals(TEXT("shatter"), ESearchCase::IgnoreCase)
+			? ShatterStrain : FCString::Atof(*Token));
+	}
+
+	TArray<UGeometryCollection*> Assets;
+	GatherAssets(AssetsParam, PathParam, Assets);
+
+	if (Assets.IsEmpty() || Strains.IsEmpty())
+	{
+		UE_LOG(LogCatVenturesEditor, Error, TEXT("CatFractureBenchmark — nothing to run (%d assets, %d strain levels)."),
+			Assets.Num(), Strains.Num());
+		return 1;
+	}
+
+	// Per-prop cost, not per-match: a budget would retire the very fragments being measured.
+	IConsoleVariable* BudgetVar = IConsoleManager::Get().FindConsoleVariable(TEXT("cat.Debris.Budget"));
+	const int32 SavedBudget = BudgetVar ? BudgetVar->GetInt() : -1;
+	if (BudgetVar) BudgetVar->Set(0, ECVF_SetByCode);
+
+	TArray<FString> Lines;
+	Lines.Add(TEXT("Asset,Strain,Transforms,Leaves,BrokenOff,ActiveAtEnd,PeakSolverParticles,PeakStepMs,AvgStepMs,AssetKB,InstanceKB"));
+
+	for (UGeometryCollection* Asset : Assets)
+	{
+		for (const float Strain : Strains)
+		{
+			FBenchmarkResult Result;
+			if (!RunOne(Asset, Strain, Seconds, StepHz, Result)) continue;
+
+			Lines.Add(FString::Printf(TEXT("%s,%s,%d,%d,%d,%d,%d,%.3f,%.3f,%lld,%lld"),
+				*Result.AssetPath, *Result.StrainLabel, Result.Transforms, Result.Leaves, Result.BrokenOff,
+				Result.ActiveAtEnd, Result.PeakSolverParticles, Result.PeakStepMs, Result.AvgStepMs,
+				Result.AssetBytes / 1024, Result.InstanceBytes / 1024));
+
+			UE_LOG(LogCatVenturesEditor, Display, TEXT("%s @ %s — %d broken off, peak %.2f ms, avg %.2f ms"),
+				*Result.AssetPath, *Result.StrainLabel, Result.BrokenOff, Result.PeakStepMs, Result.AvgStepMs);
+		}
+	}
+
+	if (BudgetVar) BudgetVar->Set(SavedBudget, ECVF_SetByCode);
+
+	if (OutputParam.IsEmpty())
+	{
+		OutputParam = FPaths::ProfilingDir() / FString::Printf(TEXT("CatFractureBenchmark-%s.csv"),
+			*FDateTime::Now().ToString());
+	}
+
+	if (!FFileHelper::SaveStringArrayToFile(Lines, *OutputParam))
+	{
+		UE_LOG(LogCatVenturesEditor, Error, TEXT("CatFractureBenchmark — could not write '%s'."), *OutputParam);
+		return 1;
+	}
+
+	UE_LOG(LogCatVenturesEditor, Display, TEXT("CatFractureBenchmark — %d rows written to %s"),
+		Lines.Num() - 1, *FPaths::ConvertRelativePathToFull(OutputParam));
+	return 0;
+}
+
+void UCatFractureBenchmarkCommandlet::GatherAssets(const FString& AssetsParam, const FString& PathParam,
+	TArray<UGeometryCollection*>& OutAssets)
+{
+	if (!AssetsParam.IsEmpty())
+	{
+		TArray<FString> Paths;
+		AssetsParam.ParseIntoArray(Paths, TEXT(","));
+		for (const FString& Path : Paths)
+		{
+			if (UGeometryCollection* Asset = LoadObject<UGeometryCollection>(nullptr, *Path.TrimStartAndEnd()))
+			{
+				OutAssets.Add(Asset);
+			}
+			else
+			{
+				UE_LOG(LogCatVenturesEditor, Warning, TEXT("CatFractureBenchmark — '%s' is not a geometry collection."), *Path);
+			}
+		}
+		return;
+	}
+
+	IAssetRegistry& Registry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	Registry.SearchAllAssets(/*bSynchronousSearch=*/true);
+
+	TArray<FAssetData> Found;
+	Registry.GetAssetsByPath(FName(*PathParam), Found, /*bRecursive=*/true);
+
+	for (const FAssetData& Data : Found)
+	{
+		if (Data.IsInstanceOf(UGeometryCollection::StaticClass()))
+		{
+			if (UGeometryCollection* Asset = Cast<UGeometryCollection>(Data.GetAsset()))
+			{
+				OutAssets.Add(Asset);
+			}
+		}
+	}
+}
+
+UWorld* UCatFractureBenchmarkCommandlet::CreateBenchmarkWorld()
+{
+	// The project ticks physics async; the scene and UCatAsyncPhysicsSubsystem read the
+	// setting as the world comes up, so clear it for that long to get a synchronous solver.
+	UPhysicsSettings* PhysicsSettings = UPhysicsSettings::Get();
+	const bool bSavedTickAsync = PhysicsSettings->bTickPhysicsAsync;
+	PhysicsSettings->bTickPhysicsAsync = false;
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, /*bInformEngineOfWorld=*/false, TEXT("CatFractureBenchmark"));
+	FWorldContext& Context = GEngine->CreateNewWorldContext(EWorldType::Game);
+	Context.SetCurrentWorld(World);
+
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+
+	PhysicsSettings->bTickPhysicsAsync = bSavedTickAsync;
+
+	// StepWorld advances the solver itself, so World->Tick must not.
+	World->bShouldSimulatePhysics = false;
+
+	// A floor, so debris settles and the lifecycle's freeze path is part of the measurement.
+	if (UStaticMesh* Cube = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube")))
+	{
+		AStaticMeshActor* Floor = World->SpawnActor<AStaticMeshActor>(FVector(0.0, 0.0, -50.0), FRotator::ZeroRotator);
+		Floor->GetStaticMeshComponent()->SetStaticMesh(Cube);
+		Floor->SetActorScale3D(FVector(100.0, 100.0, 1.0));
+	}
+
+	return World;
+}
+
+void UCatFractureBenchmarkCommandlet::DestroyBenchmarkWorld(UWorld* World)
+{
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(/*bInformEngineOfWorld=*/false);
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+}
+
+double UCatFractureBenchmarkCommandlet::StepWorld(UWorld* World, float Dt, int32& OutSolverParticles)
+{
+	FPhysScene* Scene = World->GetPhysicsScene();
+	Chaos::FPhysicsSolver* Solver = Scene->GetSolver();
+	const FVector Gravity(0.0, 0.0, World->GetGravityZ());
+
+	// One step, no substeps — what a synchronous StartPhysics/EndPhysics pair does in a match.
+	Scene->SetUpForFrame(&Gravity, Dt, /*InMinPhysicsDeltaTime=*/0.0f, /*InMaxPhysicsDeltaTime=*/Dt,
+		/*InMaxSubstepDeltaTime=*/Dt, /*InMaxSubsteps=*/1, /*bSubstepping=*/false);
+
+	const double Start = FPlatformTime::Seconds();
+	Scene->StartFrame();
+	Scene->WaitPhysScenes();
+	const double Ms = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+	// The solver is idle until the next StartFrame.
+	OutSolverParticles = Solver->GetParticles().GetNonDisabledDynamicView().Num();
+
+	// Results back to the components, then the game-thread rest of the frame (debris lifecycle).
+	Scene->EndFrame();
+	World->Tick(LEVELTICK_All, Dt);
+
+	return Ms;
+}
+
+bool UCatFractureBenchmarkCommandlet::RunOne(UGeometryCollection* Asset, float Strain, float Seconds, float StepHz,
+	FBenchmarkResult& OutResult)
+{
+	OutResult.AssetPath   = Asset->GetPathName();
+	OutResult.StrainLabel = Strain == ShatterStrain ? FString(TEXT("shatter")) : FString::SanitizeFloat(Strain);
+	OutResult.AssetBytes  = Asset->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+
+	UWorld* World = CreateBenchmarkWorld();
+
+	AGeometryCollectionActor* Actor = World->SpawnActorDeferred<AGeometryCollectionActor>(
+		AGeometryCollectionActor::StaticClass(), FTransform(FVector(0.0, 0.0, 100.0)));
+	UGeometryCollectionComponent* GCC = Actor ? Actor->GetGeometryCollectionComponent() : nullptr;
+	if (!GCC)
+	{
+		DestroyBenchmarkWorld(World);
+		return false;
+	}
+
+	GCC->SetRestCollection(Asset);
+	GCC->SetSimulatePhysics(true);
+	Actor->FinishSpawning(FTransform(FVector(0.0, 0.0, 100.0)));
+
+	const float Dt = 1.0f / StepHz;
+	int32 SolverParticles = 0;
+
+	// One step so the proxy exists before strain is applied.
+	StepWorld(World, Dt, SolverParticles);
+
+	const FVector HitLocation = GCC->Bounds.Origin + FVector(GCC->Bounds.BoxExtent.X, 0.0, 0.0);
+	if (Strain == ShatterStrain)
+	{
+		ACatBase::ForceShatterGC(GCC, HitLocation);
+	}
+	else
+	{
+		ACatBase::ApplyGradedFracture(GCC, HitLocation, GCC->Bounds.SphereRadius, Strain);
+	}
+
+	const int32 Steps = FMath::CeilToInt(Seconds * StepHz);
+	double TotalMs = 0.0;
+
+	for (int32 Step = 0; Step < Steps; ++Step)
+	{
+		const double Ms = StepWorld(World, Dt, SolverParticles);
+
+		TotalMs += Ms;
+		OutResult.PeakStepMs = FMath::Max(OutResult.PeakStepMs, Ms);
+		OutResult.PeakSolverParticles = FMath::Max(OutResult.PeakSolverParticles, SolverParticles);
+	}
+	OutResult.AvgStepMs = TotalMs / Steps;
+
+	if (FGeometryDynamicCollection* DynCollection = GCC->GetDynamicCollection())
+	{
+		FGeometryCollectionDynamicStateFacade StateFacade(*DynCollection);
+		OutResult.Transforms    = DynCollection->GetNumTransforms();
+		OutResult.InstanceBytes = static_cast<int64>(DynCollection->GetAllocatedSize());
+
+		for (int32 i = 0; i < OutResult.Transforms; ++i)
+		{
+			if (StateFacade.HasChildren(i)) continue;
+
+			++OutResult.Leaves;
+			if (StateFacade.HasBrokenOff(i)) ++OutResult.BrokenOff;
+			if (StateFacade.HasBrokenOff(i) && StateFacade.IsActive(i)) ++OutResult.ActiveAtEnd;
+		}
+	}
+
+	DestroyBenchmarkWorld(World);
+	return true;
+}
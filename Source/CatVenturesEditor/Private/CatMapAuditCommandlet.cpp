@@ -0,0 +1,258 @@
+// CatMapAuditCommandlet.cpp
+
+#include "CatMapAuditCommandlet.h"
+#include "CatVenturesEditor.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "GeometryCollection/GeometryCollection.h"
+#include "GeometryCollection/GeometryCollectionObject.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "WorldPartition/ActorDescContainer.h"
+#include "WorldPartition/ActorDescList.h"
+#include "WorldPartition/WorldPartitionActorDesc.h"
+
+UCatMapAuditCommandlet::UCatMapAuditCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UCatMapAuditCommandlet::Main(const FString& Params)
+{
+	TArray<FString> MapsToAudit = Maps;
+
+	FString MapsParam;
+	if (FParse::Value(*Params, TEXT("Maps="), MapsParam, /*bShouldStopOnSeparator=*/false))
+	{
+		MapsToAudit.Reset();
+		MapsParam.ParseIntoArray(MapsToAudit, TEXT(","));
+	}
+
+	if (MapsToAudit.IsEmpty() || Categories.IsEmpty())
+	{
+		UE_LOG(LogCatVenturesEditor, Error, TEXT("CatMapAudit — no maps or categories configured."));
+		return 1;
+	}
+
+	AssetRegistry = &FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	AssetRegistry->SearchAllAssets(/*bSynchronousSearch=*/true);
+
+	// Category classes are small — load them once for IsChildOf checks.
+	CategoryClasses.Reset();
+	for (const FCatAuditCategory& Category : Categories)
+	{
+		UClass* Class = Category.Class.TryLoadClass<AActor>();
+		if (!Class)
+		{
+			UE_LOG(LogCatVenturesEditor, Warning, TEXT("CatMapAudit — category '%s': class '%s' not found."),
+				*Category.Name.ToString(), *Category.Class.ToString());
+		}
+		CategoryClasses.Add(Class);
+	}
+
+	bool bFailed = false;
+	for (const FString& Map : MapsToAudit)
+	{
+		const int32 OverBudget = AuditMap(Map.TrimStartAndEnd());
+		bFailed |= OverBudget != 0;
+	}
+
+	return bFailed ? 1 : 0;
+}
+
+int32 UCatMapAuditCommandlet::AuditMap(const FString& MapPackageName)
+{
+	if (!FPackageName::DoesPackageExist(MapPackageName))
+	{
+		UE_LOG(LogCatVenturesEditor, Error, TEXT("CatMapAudit — map '%s' not found."), *MapPackageName);
+		return INDEX_NONE;
+	}
+
+	// Reads the actor descriptors from the map's external actor packages. No actors are loaded.
+	UActorDescContainer* Container = NewObject<UActorDescContainer>(GetTransientPackage());
+	Container->Initialize(UActorDescContainer::FInitializeParams(FName(*MapPackageName)));
+
+	TMap<FIntPoint, FCellTotals> Cells;
+	TMap<FName, int32> MapCounts;
+	int32 MapParticles = 0;
+	int32 MapBodies = 0;
+
+	for (FActorDescList::TIterator<> It(Container); It; ++It)
+	{
+		const FWorldPartitionActorDesc& ActorDesc = **It;
+
+		const int32 CategoryIndex = FindCategory(ActorDesc);
+		if (CategoryIndex == INDEX_NONE) continue;
+
+		const FCatAuditCategory& Category = Categories[CategoryIndex];
+
+		int32 Particles = Category.ParticlesPerInstance;
+		int32 Bodies    = Category.BodiesPerInstance;
+
+		if (Category.bMeasureGeometryCollections)
+		{
+			const int32 Leaves = MeasureGeometryCollections(ActorDesc.GetActorPackage(),
+				ActorDesc.GetBaseClass().IsValid() ? ActorDesc.GetBaseClass().GetPackageName() : NAME_None);
+			if (Leaves > 0)
+			{
+				Particles = Leaves;
+				Bodies    = Leaves;
+			}
+		}
+
+		const FVector Center = ActorDesc.GetRuntimeBounds().GetCenter();
+		const FIntPoint CellCoord(FMath::FloorToInt(Center.X / CellSize), FMath::FloorToInt(Center.Y / CellSize));
+
+		FCellTotals& Cell = Cells.FindOrAdd(CellCoord);
+		++Cell.Counts.FindOrAdd(Category.Name);
+		Cell.Particles += Particles;
+		Cell.Bodies    += Bodies;
+
+		++MapCounts.FindOrAdd(Category.Name);
+		MapParticles += Particles;
+		MapBodies    += Bodies;
+	}
+
+	Container->Uninitialize();
+
+	// ── Report ──────────────────────────────────────────────────────
+
+	UE_LOG(LogCatVenturesEditor, Display, TEXT("CatMapAudit — %s: %d cells, worst case %d particles, %d bodies"),
+		*MapPackageName, Cells.Num(), MapParticles, MapBodies);
+	for (const FCatAuditCategory& Category : Categories)
+	{
+		UE_LOG(LogCatVenturesEditor, Display, TEXT("    %-16s %d"), *Category.Name.ToString(), MapCounts.FindRef(Category.Name));
+	}
+
+	Cells.KeySort([](const FIntPoint& A, const FIntPoint& B)
+	{
+		return A.Y != B.Y ? A.Y < B.Y : A.X < B.X;
+	});
+
+	TArray<FString> Lines;
+	FString Header = TEXT("CellX,CellY,Particles,Bodies");
+	for (const FCatAuditCategory& Category : Categories)
+	{
+		Header += TEXT(",") + Category.Name.ToString();
+	}
+	Lines.Add(Header);
+
+	int32 OverBudget = 0;
+	for (const TPair<FIntPoint, FCellTotals>& Pair : Cells)
+	{
+		const FCellTotals& Cell = Pair.Value;
+
+		FString Line = FString::Printf(TEXT("%d,%d,%d,%d"), Pair.Key.X, Pair.Key.Y, Cell.Particles, Cell.Bodies);
+		for (const FCatAuditCategory& Category : Categories)
+		{
+			Line += FString::Printf(TEXT(",%d"), Cell.Counts.FindRef(Category.Name));
+		}
+		Lines.Add(Line);
+
+		if (Cell.Particles > MaxParticlesPerCell || Cell.Bodies > MaxBodiesPerCell)
+		{
+			++OverBudget;
+			UE_LOG(LogCatVenturesEditor, Error,
+				TEXT("CatMapAudit — %s cell (%d, %d) over budget: %d/%d particles, %d/%d bodies"),
+				*MapPackageName, Pair.Key.X, Pair.Key.Y,
+				Cell.Particles, MaxParticlesPerCell, Cell.Bodies, MaxBodiesPerCell);
+		}
+	}
+
+	const FString OutputPath = FPaths::ProfilingDir() / FString::Printf(TEXT("CatMapAudit-%s.csv"),
+		*FPackageName::GetShortName(MapPackageName));
+	if (!FFileHelper::SaveStringArrayToFile(Lines, *OutputPath))
+	{
+		UE_LOG(LogCatVenturesEditor, Error, TEXT("CatMapAudit — could not write '%s'."), *OutputPath);
+		return INDEX_NONE;
+	}
+
+	return OverBudget;
+}
+
+int32 UCatMapAuditCommandlet::FindCategory(const FWorldPartitionActorDesc& ActorDesc)
+{
+	// Blueprint actors report their generated class as the base class; native actors don't.
+	const FTopLevelAssetPath ClassPath = ActorDesc.GetBaseClass().IsValid()
+		? ActorDesc.GetBaseClass() : ActorDesc.GetNativeClass();
+
+	if (const int32* Cached = CategoryByClass.Find(ClassPath))
+	{
+		return *Cached;
+	}
+
+	int32 Found = INDEX_NONE;
+	if (const UClass* Class = LoadObject<UClass>(nullptr, *ClassPath.ToString()))
+	{
+		for (int32 i = 0; i < CategoryClasses.Num(); ++i)
+		{
+			if (CategoryClasses[i] && Class->IsChildOf(CategoryClasses[i]))
+			{
+				Found = i;
+				break;
+			}
+		}
+	}
+
+	CategoryByClass.Add(ClassPath, Found);
+	return Found;
+}
+
+int32 UCatMapAuditCommandlet::MeasureGeometryCollections(FName ActorPackage, FName ClassPackage)
+{
+	// Instance-assigned GCs show up as the actor package's dependencies; GCs set on the
+	// Blueprint's default component only as the class package's.
+	for (const FName Package : { ActorPackage, ClassPackage })
+	{
+		if (Package.IsNone()) continue;
+
+		TArray<FName> Dependencies;
+		AssetRegistry->GetDependencies(Package, Dependencies, UE::AssetRegistry::EDependencyCategory::Package,
+			UE::AssetRegistry::EDependencyQuery::Hard);
+
+		int32 Leaves = 0;
+		for (const FName Dependency : Dependencies)
+		{
+			TArray<FAssetData> Assets;
+			AssetRegistry->GetAssetsByPackageName(Dependency, Assets);
+			for (const FAssetData& Asset : Assets)
+			{
+				if (Asset.IsInstanceOf(UGeometryCollection::StaticClass()))
+				{
+					Leaves += GetLeafCount(Asset.GetSoftObjectPath());
+				}
+			}
+		}
+
+		if (Leaves > 0) return Leaves;
+	}
+	return 0;
+}
+
+int32 UCatMapAuditCommandlet::GetLeafCount(const FSoftObjectPath& AssetPath)
+{
+	if (const int32* Cached = LeafCountByAsset.Find(AssetPath))
+	{
+		return *Cached;
+	}
+
+	int32 Leaves = 0;
+	if (const UGeometryCollection* Asset = Cast<UGeometryCollection>(AssetPath.TryLoad()))
+	{
+		if (const FGeometryCollection* Collection = Asset->GetGeometryCollection().Get())
+		{
+			const int32 NumTransforms = Collection->NumElements(FGeometryCollection::TransformGroup);
+			for (int32 i = 0; i < NumTransforms; ++i)
+			{
+				if (Collection->Children[i].IsEmpty()) ++Leaves;
+			}
+		}
+	}
+
+	LeafCountByAsset.Add(AssetPath, Leaves);
+	return Leaves;
+}
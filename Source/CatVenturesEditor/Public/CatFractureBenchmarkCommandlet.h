@@ -0,0 +1,75 @@
+// CatFractureBenchmarkCommandlet.h — Headless per-asset fracture cost measurement.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "CatFractureBenchmarkCommandlet.generated.h"
+
+class UGeometryCollection;
+class UWorld;
+
+/**
+ * Measures what a geometry collection asset costs at runtime before it is placed.
+ *
+ * For each asset and each strain level the commandlet spins up an empty game world,
+ * drops the GC onto a floor, breaks it with the game's own fracture entry points
+ * (ACatBase::ApplyGradedFracture, or ACatBase::ForceShatterGC for the "shatter" level)
+ * and advances the Chaos solver at a fixed rate. One CSV row per run: particle counts,
+ * peak and average solver step time, asset and per-instance collection memory.
+ *
+ * The benchmark world always steps physics synchronously, one solver advance per frame,
+ * whatever the project's async physics setting — only that advance is timed, not the
+ * rest of the world tick. InstanceKB is the GC's dynamic collection (per-placed-prop
+ * state); PeakSolverParticles is the most non-disabled dynamic particles the solver
+ * held at once.
+ *
+ *   UnrealEditor-Cmd CatVentures.uproject -run=CatFractureBenchmark -nullrhi -unattended
+ *       [-Assets=/Game/Chaos/GC_Cylinder,...]   default: every UGeometryCollection under -Path
+ *       [-Path=/Game]
+ *       [-Strains=500,5000,50000,shatter]
+ *       [-Seconds=5] [-Hz=60]
+ *       [-Output=<file.csv>]                    default: Saved/Profiling/CatFractureBenchmark-<time>.csv
+ *
+ * The debris particle budget is lifted for the run so no fragment is retired early;
+ * the settle/freeze lifecycle still runs, as it would in a match.
+ */
+UCLASS()
+class UCatFractureBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UCatFractureBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	/** Strain value for a level; ShatterStrain marks the ForceShatterGC level. */
+	static constexpr float ShatterStrain = -1.0f;
+
+	struct FBenchmarkResult
+	{
+		FString AssetPath;
+		FString StrainLabel;
+		int32 Transforms = 0;
+		int32 Leaves = 0;
+		int32 BrokenOff = 0;
+		int32 ActiveAtEnd = 0;
+		int32 PeakSolverParticles = 0;
+		double PeakStepMs = 0.0;
+		double AvgStepMs = 0.0;
+		int64 AssetBytes = 0;
+		int64 InstanceBytes = 0;
+	};
+
+	bool RunOne(UGeometryCollection* Asset, float Strain, float Seconds, float StepHz, FBenchmarkResult& OutResult);
+
+	static void GatherAssets(const FString& AssetsParam, const FString& PathParam, TArray<UGeometryCollection*>& OutAssets);
+	static UWorld* CreateBenchmarkWorld();
+	static void DestroyBenchmarkWorld(UWorld* World);
+
+	/** One synchronous solver advance of Dt, then the rest of the frame. Returns the
+	 *  solver's wall time in ms; OutSolverParticles is its live dynamic particle count. */
+	static double StepWorld(UWorld* World, float Dt, int32& OutSolverParticles);
+};
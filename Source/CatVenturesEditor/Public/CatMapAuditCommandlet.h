@@ -0,0 +1,107 @@
+// CatMapAuditCommandlet.h — Per-cell destruction and physics budget audit for World Partition maps.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "CatMapAuditCommandlet.generated.h"
+
+class IAssetRegistry;
+class FWorldPartitionActorDesc;
+
+/** One class of gameplay actor the audit counts, and what an instance costs when everything breaks. */
+USTRUCT()
+struct FCatAuditCategory
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Config)
+	FName Name;
+
+	/** Instances of this class or any subclass (native or Blueprint) are counted. */
+	UPROPERTY(Config)
+	FSoftClassPath Class;
+
+	/** Worst-case live physics particles per instance. */
+	UPROPERTY(Config)
+	int32 ParticlesPerInstance = 1;
+
+	/** Worst-case collision bodies per instance. */
+	UPROPERTY(Config)
+	int32 BodiesPerInstance = 1;
+
+	/** Replace both per-instance costs with the leaf count of the actor's geometry
+	 *  collection asset — every leaf is a particle and a body once fully broken. */
+	UPROPERTY(Config)
+	bool bMeasureGeometryCollections = false;
+};
+
+/**
+ * Audits World Partition maps from their actor descriptors — the full world is never
+ * loaded. Each external actor is matched against Categories, its worst-case cost is
+ * estimated, and the totals are bucketed into a 2D grid of CellSize cells. Geometry
+ * collection leaf counts come from the asset registry's dependency graph: only the GC
+ * asset is loaded, never the actor.
+ *
+ *   UnrealEditor-Cmd CatVentures.uproject -run=CatMapAudit -unattended [-Maps=/Game/Maps/TestMap_01,...]
+ *
+ * Returns non-zero and logs an error per offending cell when any cell exceeds
+ * MaxParticlesPerCell or MaxBodiesPerCell. Per-cell totals are written to
+ * Saved/Profiling/CatMapAudit-<Map>.csv. Tuning lives in DefaultEditor.ini under
+ * [/Script/CatVenturesEditor.CatMapAuditCommandlet].
+ */
+UCLASS(Config = Editor)
+class UCatMapAuditCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UCatMapAuditCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+	/** Maps audited when -Maps= isn't given. Long package names. */
+	UPROPERTY(Config)
+	TArray<FString> Maps;
+
+	UPROPERTY(Config)
+	TArray<FCatAuditCategory> Categories;
+
+	/** Edge length (cm) of an audit cell. Match the runtime grid's cell size. */
+	UPROPERTY(Config)
+	float CellSize = 3200.0f;
+
+	UPROPERTY(Config)
+	int32 MaxParticlesPerCell = 2000;
+
+	UPROPERTY(Config)
+	int32 MaxBodiesPerCell = 600;
+
+private:
+	struct FCellTotals
+	{
+		TMap<FName, int32> Counts;
+		int32 Particles = 0;
+		int32 Bodies = 0;
+	};
+
+	/** Audits one map. Returns the number of cells over budget, or INDEX_NONE if the map is
+	 *  missing or its report can't be written. */
+	int32 AuditMap(const FString& MapPackageName);
+
+	/** Index into Categories of the first category ActorDesc's class belongs to. */
+	int32 FindCategory(const FWorldPartitionActorDesc& ActorDesc);
+
+	/** Leaf count of the GC assets Package references (directly, else through its class). 0 if none. */
+	int32 MeasureGeometryCollections(FName ActorPackage, FName ClassPackage);
+	int32 GetLeafCount(const FSoftObjectPath& AssetPath);
+
+	IAssetRegistry* AssetRegistry = nullptr;
+
+	/** Loaded Categories[i].Class, or null. UPROPERTY so GC keeps them alive between maps. */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UClass>> CategoryClasses;
+
+	TMap<FTopLevelAssetPath, int32> CategoryByClass;
+	TMap<FSoftObjectPath, int32> LeafCountByAsset;
+};